@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <KDecoration3/DecorationButton>
+
+#include <QColor>
+#include <QRectF>
+
+class QPainter;
+
+namespace Breeze
+{
+
+    //* button painters of the initial import, the reference for the button styles
+    namespace Baseline
+    {
+
+        //* everything the painters read from the button, its decoration and its animation
+        struct ButtonState
+        {
+
+            //* InternalSettings::buttonStyle
+            int style = 0;
+
+            KDecoration3::DecorationButtonType type = KDecoration3::DecorationButtonType::Close;
+
+            //* button geometry, in logical pixels
+            QRectF geometry;
+
+            //*@name button state
+            //@{
+            bool hovered = false;
+            bool pressed = false;
+            bool checked = false;
+            //@}
+
+            //*@name window state
+            //@{
+            bool active = true;
+            bool maximized = false;
+            //@}
+
+            //*@name hover animation
+            //@{
+            bool animating = false;
+            qreal opacity = 0;
+            //@}
+
+            //*@name colors
+            //@{
+            QColor titleBar;
+            QColor font;
+            QColor warning;
+            //@}
+
+        };
+
+        //* render a button as the initial import did
+        void render(QPainter *painter, const ButtonState &state);
+
+    }
+
+}
@@ -0,0 +1,467 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezebuttonbaseline.h"
+#include "breezebuttoncache.h"
+#include "breezebuttonstyle.h"
+
+#include <QCommandLineParser>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QGuiApplication>
+#include <QImage>
+#include <QPainter>
+#include <QTextStream>
+
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+
+//__________________________________________________________________
+// allocation counter
+/*
+ * malloc and friends are interposed so that allocations made inside Qt are counted as well.
+ * This relies on glibc exporting its allocator as __libc_*. Elsewhere, allocations are not counted.
+ */
+#if defined(__GLIBC__)
+#define BREEZE_BENCH_COUNT_ALLOCATIONS 1
+
+static std::atomic<quint64> s_allocations(0);
+
+extern "C"
+{
+    void *__libc_malloc(size_t);
+    void *__libc_calloc(size_t, size_t);
+    void *__libc_realloc(void*, size_t);
+
+    void *malloc(size_t size) noexcept
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t count, size_t size) noexcept
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_calloc(count, size);
+    }
+
+    void *realloc(void *pointer, size_t size) noexcept
+    {
+        s_allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_realloc(pointer, size);
+    }
+}
+
+static quint64 allocations()
+{ return s_allocations.load(std::memory_order_relaxed); }
+
+#else
+#define BREEZE_BENCH_COUNT_ALLOCATIONS 0
+
+static quint64 allocations()
+{ return 0; }
+
+#endif
+
+namespace Breeze
+{
+
+    using KDecoration3::DecorationButtonType;
+
+    namespace
+    {
+
+        //* button types that have a style, i.e. all but the window menu and spacer
+        const DecorationButtonType s_types[] = {
+            DecorationButtonType::ApplicationMenu,
+            DecorationButtonType::OnAllDesktops,
+            DecorationButtonType::Minimize,
+            DecorationButtonType::Maximize,
+            DecorationButtonType::Close,
+            DecorationButtonType::ContextHelp,
+            DecorationButtonType::Shade,
+            DecorationButtonType::KeepBelow,
+            DecorationButtonType::KeepAbove };
+
+        const char *const s_styleNames[] = { "macsymbols", "aqua", "sunken", "plasma", "oxygen" };
+
+        const char *const s_typeNames[] = { "appmenu", "alldesktops", "minimize", "maximize", "close", "help", "shade", "keepbelow", "keepabove" };
+
+        //* button states, as ButtonRenderState flags, hover animation value and animation setting
+        struct State
+        {
+            const char *name;
+            int flags;
+            qreal opacity;
+            bool animationsEnabled;
+        };
+
+        const State s_states[] = {
+            { "normal", ButtonRenderState::Active, 0, true },
+            { "hovered", ButtonRenderState::Active|ButtonRenderState::Hovered, 0, true },
+            { "hoverednoanimation", ButtonRenderState::Active|ButtonRenderState::Hovered, 0, false },
+            { "animating", ButtonRenderState::Active|ButtonRenderState::Hovered|ButtonRenderState::Animating, 0.5, true },
+            { "animating25", ButtonRenderState::Active|ButtonRenderState::Hovered|ButtonRenderState::Animating, 0.25, true },
+            { "animatingout", ButtonRenderState::Active|ButtonRenderState::Animating, 0.75, true },
+            { "pressed", ButtonRenderState::Active|ButtonRenderState::Hovered|ButtonRenderState::Pressed, 0, true },
+            { "checked", ButtonRenderState::Active|ButtonRenderState::Checked, 0, true },
+            { "checkedhovered", ButtonRenderState::Active|ButtonRenderState::Checked|ButtonRenderState::Hovered, 0, true },
+            { "checkedpressed", ButtonRenderState::Active|ButtonRenderState::Checked|ButtonRenderState::Hovered|ButtonRenderState::Pressed, 0, true },
+            { "maximized", ButtonRenderState::Active|ButtonRenderState::Maximized, 0, true },
+            { "maximizedhovered", ButtonRenderState::Active|ButtonRenderState::Maximized|ButtonRenderState::Hovered, 0, true },
+            { "inactive", 0, 0, true },
+            { "inactivechecked", ButtonRenderState::Checked, 0, true },
+            { "inactivehovered", ButtonRenderState::Hovered, 0, true },
+            { "inactiveanimating", ButtonRenderState::Hovered|ButtonRenderState::Animating, 0.5, true } };
+
+        //* quantized hover animation steps, the AnimationSteps default
+        const int s_animationSteps = 16;
+
+        //* logical button sizes
+        const int s_sizes[] = { 16, 20, 24, 32 };
+
+        //* device pixel ratios
+        const qreal s_scales[] = { 1, 1.25, 2 };
+
+        //* title bar palettes, from the Breeze dark and light color schemes
+        struct TitleBar
+        {
+            const char *name;
+            ButtonTitleBarColors colors;
+        };
+
+        TitleBar titleBar(const char *name, const QColor &background, const QColor &font, const QColor &warning = QColor(218, 68, 83))
+        {
+            TitleBar out;
+            out.name = name;
+            out.colors.titleBar = background;
+            out.colors.font = font;
+            out.colors.warning = warning;
+            out.colors.hoveredWarning = out.colors.warning.lighter();
+            out.colors.lightTitleBar = qGray(background.rgb()) > 100;
+            return out;
+        }
+
+        //* one benchmark case
+        struct Case
+        {
+            int style;
+            int type;
+            const State *state;
+            int size;
+            qreal scale;
+            const TitleBar *titleBar;
+
+            QString name() const
+            {
+                return QStringLiteral("%1-%2-%3-%4-%5x-%6")
+                    .arg(QLatin1String(s_styleNames[style]), QLatin1String(s_typeNames[type]), QLatin1String(state->name))
+                    .arg(size).arg(scale).arg(QLatin1String(titleBar->name));
+            }
+        };
+
+        //* hover animation frame of a case, as Button::paint computes it
+        int spriteFrame(const Case &c)
+        { return (c.state->flags & ButtonRenderState::Animating) ? ButtonCache::spriteFrame(c.state->opacity, s_animationSteps) : 0; }
+
+        //* full state of a case, as Button::paint computes it
+        ButtonRenderState renderState(const ButtonStyle &style, const Case &c)
+        {
+            const int flags = c.state->flags;
+            ButtonRenderState state(style.renderState(c.titleBar->colors, flags, ButtonCache::spriteProgress(flags, spriteFrame(c), s_animationSteps, c.state->animationsEnabled)));
+            state.width = c.size;
+            return state;
+        }
+
+        //* image covering the button and its margin, as the sprites of Button::paint
+        QImage createImage(const Case &c)
+        {
+            const qreal margin = ButtonCache::margin(QSizeF(c.size, c.size));
+            const QSizeF size = QSizeF(c.size, c.size) + 2*QSizeF(margin, margin);
+            QImage image((size*c.scale).toSize(), QImage::Format_ARGB32_Premultiplied);
+            image.setDevicePixelRatio(c.scale);
+            image.fill(Qt::transparent);
+            return image;
+        }
+
+        //* vector path, as Button::renderIcon
+        void renderVector(QPainter *painter, const ButtonStyle &style, const ButtonRenderState &state, const Case &c)
+        {
+            const qreal margin = ButtonCache::margin(QSizeF(c.size, c.size));
+
+            painter->save();
+            painter->translate(margin, margin);
+            painter->scale(qreal(c.size)/20, qreal(c.size)/20);
+            painter->translate(1, 1);
+            style.render(painter, state);
+            painter->restore();
+        }
+
+        //* cached path, as Button::paint
+        void renderCached(QPainter *painter, const ButtonStyle &style, const ButtonRenderState &state, const Case &c)
+        {
+            const ButtonSpriteKey key(ButtonCache::spriteKey(style, c.titleBar->colors, state, spriteFrame(c), c.state->animationsEnabled, QSizeF(c.size, c.size), c.scale));
+
+            QImage sprite = ButtonCache::self()->sprite(key);
+            if (sprite.isNull())
+            {
+                sprite = createImage(c);
+                QPainter spritePainter(&sprite);
+                renderVector(&spritePainter, style, state, c);
+                spritePainter.end();
+                ButtonCache::self()->insert(key, sprite);
+            }
+
+            painter->drawImage(QPointF(0, 0), sprite);
+        }
+
+        //* painters of the initial import, as Button::paint called them
+        void renderBaseline(QPainter *painter, const ButtonRenderState &state, const Case &c)
+        {
+            const qreal margin = ButtonCache::margin(QSizeF(c.size, c.size));
+
+            Baseline::ButtonState baseline;
+            baseline.style = c.style;
+            baseline.type = s_types[c.type];
+            baseline.geometry = QRectF(margin, margin, c.size, c.size);
+            baseline.hovered = state.flags & ButtonRenderState::Hovered;
+            baseline.pressed = state.flags & ButtonRenderState::Pressed;
+            baseline.checked = state.flags & ButtonRenderState::Checked;
+            baseline.active = state.flags & ButtonRenderState::Active;
+            baseline.maximized = state.flags & ButtonRenderState::Maximized;
+            baseline.animating = state.flags & ButtonRenderState::Animating;
+
+            // the quantized animation value, so that both paths render the same frame
+            baseline.opacity = state.progress;
+
+            baseline.titleBar = c.titleBar->colors.titleBar;
+            baseline.font = c.titleBar->colors.font;
+            baseline.warning = c.titleBar->colors.warning;
+            Baseline::render(painter, baseline);
+        }
+
+        //* largest channel difference between two images of the same size
+        int maxDifference(const QImage &first, const QImage &second)
+        {
+            const QImage a = first.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+            const QImage b = second.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+            if (a.size() != b.size()) return 255;
+
+            int out = 0;
+            for (int y = 0; y < a.height(); ++y)
+            {
+                const QRgb *lineA = reinterpret_cast<const QRgb*>(a.constScanLine(y));
+                const QRgb *lineB = reinterpret_cast<const QRgb*>(b.constScanLine(y));
+                for (int x = 0; x < a.width(); ++x)
+                {
+                    out = qMax(out, qAbs(qRed(lineA[x]) - qRed(lineB[x])));
+                    out = qMax(out, qAbs(qGreen(lineA[x]) - qGreen(lineB[x])));
+                    out = qMax(out, qAbs(qBlue(lineA[x]) - qBlue(lineB[x])));
+                    out = qMax(out, qAbs(qAlpha(lineA[x]) - qAlpha(lineB[x])));
+                }
+            }
+
+            return out;
+        }
+
+        //* clear target between iterations
+        void clear(QPainter *painter, const QImage &image)
+        {
+            painter->save();
+            painter->setCompositionMode(QPainter::CompositionMode_Source);
+            painter->fillRect(QRectF(QPointF(0, 0), image.deviceIndependentSize()), Qt::transparent);
+            painter->restore();
+        }
+
+        //* timing of one render path
+        struct Result
+        {
+            qreal nsPerPaint = 0;
+            qreal allocationsPerPaint = 0;
+        };
+
+        template<typename Render>
+        Result measure(QImage &image, int iterations, Render render)
+        {
+            QPainter painter(&image);
+
+            // warm up caches, e.g. the symbol library
+            clear(&painter, image);
+            render(&painter);
+
+            const quint64 allocationsBefore = allocations();
+            QElapsedTimer timer;
+            timer.start();
+            for (int i = 0; i < iterations; ++i)
+            {
+                clear(&painter, image);
+                render(&painter);
+            }
+
+            Result out;
+            out.nsPerPaint = qreal(timer.nsecsElapsed())/iterations;
+            out.allocationsPerPaint = qreal(allocations() - allocationsBefore)/iterations;
+            return out;
+        }
+
+    }
+
+}
+
+//__________________________________________________________________
+int main(int argc, char *argv[])
+{
+    using namespace Breeze;
+
+    // no display is needed
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    { qputenv("QT_QPA_PLATFORM", "offscreen"); }
+
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName(QStringLiteral("breezeenhanced_bench"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Renders all button styles offscreen and reports the cost of a paint."));
+    parser.addHelpOption();
+
+    const QCommandLineOption iterationsOption(QStringLiteral("iterations"), QStringLiteral("Paints per case."), QStringLiteral("count"), QStringLiteral("100"));
+    const QCommandLineOption styleOption(QStringLiteral("style"), QStringLiteral("Only benchmark given button style (0-4)."), QStringLiteral("style"));
+    const QCommandLineOption dumpOption(QStringLiteral("dump"), QStringLiteral("Write the vector rendering of every case to given directory."), QStringLiteral("directory"));
+    const QCommandLineOption compareOption(QStringLiteral("compare"), QStringLiteral("Compare the renderings against reference images in given directory."), QStringLiteral("directory"));
+    const QCommandLineOption baselineOption(QStringLiteral("baseline"), QStringLiteral("Compare the renderings against the painters of the initial import."));
+    parser.addOptions({ iterationsOption, styleOption, dumpOption, compareOption, baselineOption });
+    parser.process(app);
+
+    const int iterations = qMax(1, parser.value(iterationsOption).toInt());
+    const int onlyStyle = parser.isSet(styleOption) ? parser.value(styleOption).toInt() : -1;
+    const QString dumpDirectory = parser.value(dumpOption);
+    const QString compareDirectory = parser.value(compareOption);
+    const bool compareBaseline = parser.isSet(baselineOption);
+    if (!dumpDirectory.isEmpty()) QDir().mkpath(dumpDirectory);
+
+    /*
+     * the sprite cache is shared by all cases, as by all windows. The last palette only differs
+     * in warning color, so that sprites keyed on too few colors show up as mismatches
+     */
+    const TitleBar titleBars[] = {
+        titleBar("dark", QColor(49, 54, 59), QColor(252, 252, 252)),
+        titleBar("light", QColor(227, 229, 231), QColor(35, 38, 41)),
+        titleBar("darkwarning", QColor(49, 54, 59), QColor(252, 252, 252), QColor(246, 116, 0)) };
+
+    QTextStream out(stdout);
+    out << "case\tvector ns/paint\tvector allocs/paint\tcached ns/paint\tcached allocs/paint\n";
+
+    // per style totals
+    Result totals[5][2];
+    int counts[5] = {};
+    int mismatches = 0;
+
+    for (int style = ButtonStyle::MacSymbols; style <= ButtonStyle::Oxygen; ++style)
+    {
+        if (onlyStyle >= 0 && style != onlyStyle) continue;
+
+        for (int type = 0; type < int(std::size(s_types)); ++type)
+        for (const TitleBar &bar : titleBars)
+        {
+            ButtonStyle buttonStyle(style, s_types[type]);
+            buttonStyle.setTitleBarColor(bar.colors.titleBar);
+
+            for (const State &state : s_states)
+            for (int size : s_sizes)
+            for (qreal scale : s_scales)
+            {
+                const Case c = { style, type, &state, size, scale, &bar };
+                const ButtonRenderState buttonState(renderState(buttonStyle, c));
+
+                QImage vectorImage(createImage(c));
+                const Result vector = measure(vectorImage, iterations, [&](QPainter *painter) { renderVector(painter, buttonStyle, buttonState, c); });
+
+                QImage cachedImage(createImage(c));
+                const Result cached = measure(cachedImage, iterations, [&](QPainter *painter) { renderCached(painter, buttonStyle, buttonState, c); });
+
+                const QString name = c.name();
+                out << name << '\t' << vector.nsPerPaint << '\t' << vector.allocationsPerPaint << '\t' << cached.nsPerPaint << '\t' << cached.allocationsPerPaint << '\n';
+
+                // the cached path must match the vector path pixel for pixel
+                if (cachedImage != vectorImage)
+                {
+                    out << "MISMATCH cached\t" << name << '\n';
+                    ++mismatches;
+                }
+
+                const QString fileName = name + QStringLiteral(".png");
+                if (!dumpDirectory.isEmpty())
+                { vectorImage.save(QDir(dumpDirectory).filePath(fileName)); }
+
+                if (!compareDirectory.isEmpty())
+                {
+                    QImage reference(QDir(compareDirectory).filePath(fileName));
+                    if (reference.isNull() || reference.convertToFormat(vectorImage.format()) != vectorImage)
+                    {
+                        out << "MISMATCH reference\t" << name << '\n';
+                        ++mismatches;
+                    }
+                }
+
+                // the vector path must match the painters it replaces
+                if (compareBaseline)
+                {
+                    QImage baselineImage(createImage(c));
+                    {
+                        QPainter painter(&baselineImage);
+                        renderBaseline(&painter, buttonState, c);
+                    }
+
+                    if (baselineImage != vectorImage)
+                    {
+                        out << "MISMATCH baseline\t" << name << '\t' << maxDifference(baselineImage, vectorImage) << '\n';
+                        ++mismatches;
+                    }
+                }
+
+                totals[style][0].nsPerPaint += vector.nsPerPaint;
+                totals[style][0].allocationsPerPaint += vector.allocationsPerPaint;
+                totals[style][1].nsPerPaint += cached.nsPerPaint;
+                totals[style][1].allocationsPerPaint += cached.allocationsPerPaint;
+                ++counts[style];
+            }
+        }
+    }
+
+    out << "\nstyle\tvector ns/paint\tvector allocs/paint\tcached ns/paint\tcached allocs/paint\n";
+    for (int style = 0; style < 5; ++style)
+    {
+        if (!counts[style]) continue;
+        out << s_styleNames[style]
+            << '\t' << totals[style][0].nsPerPaint/counts[style]
+            << '\t' << totals[style][0].allocationsPerPaint/counts[style]
+            << '\t' << totals[style][1].nsPerPaint/counts[style]
+            << '\t' << totals[style][1].allocationsPerPaint/counts[style] << '\n';
+    }
+
+    if (!BREEZE_BENCH_COUNT_ALLOCATIONS)
+    { out << "\nallocations are not counted on this platform\n"; }
+
+    if (mismatches)
+    { out << '\n' << mismatches << " mismatches\n"; }
+
+    return mismatches ? 1 : 0;
+}
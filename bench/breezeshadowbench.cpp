@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2018 Vlad Zagorodniy <vladzzag@gmail.com>
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+// own
+#include "breezeboxblur.h"
+#include "breezeboxshadowrenderer.h"
+
+// Qt
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPainter>
+#include <QTextStream>
+
+// C++
+#include <cmath>
+
+namespace Breeze
+{
+namespace
+{
+/**
+ * Blur radii of the shadow sizes, see s_shadowParams in breezeshadowcache.cpp.
+ **/
+const int s_radii[] = {8, 16, 24, 32, 48, 64};
+
+/**
+ * Device pixel ratios reported by KWin for common scale factors.
+ **/
+const qreal s_scales[] = {1, 1.25, 1.5, 1.75, 2, 2.5, 3};
+
+const char *const s_kernelNames[] = {"scalar", "sse2", "avx2"};
+
+/**
+ * The previous blur, kept as a reference: a sliding window over one alpha byte
+ * at a time, walking columns with a bytesPerLine stride.
+ **/
+void boxBlurRowAlpha(const uint8_t *src, uint8_t *dst, int width, int inputStep, int outputStep, const BoxLobes &lobes)
+{
+    const int boxSize = lobes.left + 1 + lobes.right;
+    const int reciprocal = (1 << 24) / boxSize;
+
+    uint32_t alphaSum = (boxSize + 1) / 2;
+
+    const uint8_t *left = src;
+    const uint8_t *right = src;
+    uint8_t *out = dst;
+
+    const uint8_t firstValue = src[0];
+    const uint8_t lastValue = src[(width - 1) * inputStep];
+
+    alphaSum += firstValue * lobes.left;
+
+    const uint8_t *initEnd = src + (boxSize - lobes.left) * inputStep;
+    while (right < initEnd) {
+        alphaSum += *right;
+        right += inputStep;
+    }
+
+    const uint8_t *leftEnd = src + boxSize * inputStep;
+    while (right < leftEnd) {
+        *out = (alphaSum * reciprocal) >> 24;
+        alphaSum += *right - firstValue;
+        right += inputStep;
+        out += outputStep;
+    }
+
+    const uint8_t *centerEnd = src + width * inputStep;
+    while (right < centerEnd) {
+        *out = (alphaSum * reciprocal) >> 24;
+        alphaSum += *right - *left;
+        left += inputStep;
+        right += inputStep;
+        out += outputStep;
+    }
+
+    const uint8_t *rightEnd = dst + width * outputStep;
+    while (out < rightEnd) {
+        *out = (alphaSum * reciprocal) >> 24;
+        alphaSum += lastValue - *left;
+        left += inputStep;
+        out += outputStep;
+    }
+}
+
+/**
+ * Box filter parameters, as computed by the blur for given radius.
+ **/
+QVector<BoxLobes> computeLobes(int radius)
+{
+    const int blurRadius = boxBlurExtent(radius);
+    const int z = blurRadius / 3;
+    switch (blurRadius % 3) {
+    case 0:
+        return {{z, z}, {z, z}, {z, z}};
+    case 1:
+        return {{z + 1, z}, {z, z + 1}, {z, z}};
+    default:
+        return {{z + 1, z}, {z, z + 1}, {z + 1, z + 1}};
+    }
+}
+
+void stridedBoxBlurAlpha(uint8_t *alpha, int pixelStride, int bytesPerLine, int width, int height, int radius)
+{
+    if (radius < 2) {
+        return;
+    }
+
+    const QVector<BoxLobes> lobes = computeLobes(radius);
+    QVector<uint8_t> buf(2 * qMax(width, height) * pixelStride);
+    uint8_t *buf1 = buf.data();
+    uint8_t *buf2 = buf1 + buf.size() / 2;
+
+    for (int i = 0; i < height; ++i) {
+        uint8_t *row = alpha + i * bytesPerLine;
+        boxBlurRowAlpha(row, buf1, width, pixelStride, pixelStride, lobes[0]);
+        boxBlurRowAlpha(buf1, buf2, width, pixelStride, pixelStride, lobes[1]);
+        boxBlurRowAlpha(buf2, row, width, pixelStride, pixelStride, lobes[2]);
+    }
+
+    for (int i = 0; i < width; ++i) {
+        uint8_t *column = alpha + i * pixelStride;
+        boxBlurRowAlpha(column, buf1, height, bytesPerLine, pixelStride, lobes[0]);
+        boxBlurRowAlpha(buf1, buf2, height, pixelStride, pixelStride, lobes[1]);
+        boxBlurRowAlpha(buf2, column, height, pixelStride, bytesPerLine, lobes[2]);
+    }
+}
+
+/**
+ * Shadow masks are blurred in place as Alpha8 images. ARGB32 images, blurred with
+ * a pixel stride of 4, are the path BoxShadowRenderer took before.
+ **/
+const QImage::Format s_formats[] = {QImage::Format_Alpha8, QImage::Format_ARGB32_Premultiplied};
+
+const char *formatName(QImage::Format format)
+{
+    return format == QImage::Format_Alpha8 ? "alpha8" : "argb32";
+}
+
+/**
+ * Unblurred shadow of given radius and scale, as BoxShadowRenderer rasterizes it.
+ **/
+QImage createShadow(int radius, qreal scale, QImage::Format format)
+{
+    const QSize boxSize = BoxShadowRenderer::calculateMinimumBoxSize(radius);
+    const int extent = boxBlurExtent(radius);
+    const QSize pixelSize = ((QSizeF(boxSize) + 2 * QSizeF(extent, extent)) * scale).toSize();
+
+    QImage image(pixelSize, format);
+    image.setDevicePixelRatio(scale);
+    image.fill(Qt::transparent);
+
+    QRectF boxRect(QPointF(0, 0), boxSize);
+    boxRect.moveCenter(QRectF(QPointF(0, 0), QSizeF(pixelSize) / scale).center());
+
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(Qt::black);
+    painter.drawRoundedRect(boxRect, 6, 6);
+    painter.end();
+
+    return image;
+}
+
+/**
+ * Mean time of a blur of the top left quadrant, in microseconds.
+ **/
+template<typename Blur>
+qreal measure(const QImage &source, QImage &result, int iterations, Blur blur)
+{
+    const int width = std::ceil(source.width() * 0.5);
+    const int height = std::ceil(source.height() * 0.5);
+
+    // the alpha byte of each pixel
+    const int pixelStride = source.depth() >> 3;
+    const int alphaOffset = pixelStride == 1 || QSysInfo::ByteOrder == QSysInfo::BigEndian ? 0 : 3;
+
+    qint64 elapsed = 0;
+    for (int i = 0; i < iterations; ++i) {
+        result = source.copy();
+        QElapsedTimer timer;
+        timer.start();
+        blur(result.bits() + alphaOffset, pixelStride, result.bytesPerLine(), width, height);
+        elapsed += timer.nsecsElapsed();
+    }
+
+    return elapsed / 1000.0 / iterations;
+}
+
+/**
+ * Shadow of given radius, as ShadowCache renders one layer, and the mean time of a render
+ * with an empty mask cache, in microseconds.
+ **/
+qreal measureGenerator(int radius, BoxShadowRenderer::Generator generator, int iterations, QImage &result)
+{
+    BoxShadowRenderer renderer;
+    renderer.setBoxSize(BoxShadowRenderer::calculateMinimumBoxSize(radius));
+    renderer.setBorderRadius(6);
+    renderer.setGenerator(generator);
+    renderer.addShadow(QPointF(0, 0), radius, Qt::black);
+
+    qint64 elapsed = 0;
+    for (int i = 0; i < iterations; ++i) {
+        BoxShadowRenderer::clearCache();
+        QElapsedTimer timer;
+        timer.start();
+        result = renderer.render();
+        elapsed += timer.nsecsElapsed();
+    }
+
+    return elapsed / 1000.0 / iterations;
+}
+
+/**
+ * Largest difference between the alpha channels of two shadows.
+ **/
+int maximumAlphaError(const QImage &a, const QImage &b)
+{
+    int error = 0;
+    for (int y = 0; y < a.height(); ++y) {
+        const QRgb *rowA = reinterpret_cast<const QRgb *>(a.constScanLine(y));
+        const QRgb *rowB = reinterpret_cast<const QRgb *>(b.constScanLine(y));
+        for (int x = 0; x < a.width(); ++x) {
+            error = qMax(error, std::abs(qAlpha(rowA[x]) - qAlpha(rowB[x])));
+        }
+    }
+
+    return error;
+}
+
+} // namespace
+} // namespace Breeze
+
+int main(int argc, char *argv[])
+{
+    using namespace Breeze;
+
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("breezeenhanced_shadowbench"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Blurs the shadows of all shadow sizes and scales, and compares the blur implementations and shadow generators."));
+    parser.addHelpOption();
+
+    const QCommandLineOption iterationsOption(QStringLiteral("iterations"), QStringLiteral("Blurs per case."), QStringLiteral("count"), QStringLiteral("50"));
+    parser.addOption(iterationsOption);
+    parser.process(app);
+
+    const int iterations = qMax(1, parser.value(iterationsOption).toInt());
+    const int kernels = int(bestBoxBlurKernel()) + 1;
+
+    QTextStream out(stdout);
+    out << "format\tradius\tscale\tquadrant\tstrided us";
+    for (int kernel = 0; kernel < kernels; ++kernel) {
+        out << '\t' << s_kernelNames[kernel] << " us";
+    }
+    out << "\tspeedup\n";
+
+    int mismatches = 0;
+    for (QImage::Format format : s_formats) {
+        for (int radius : s_radii) {
+            for (qreal scale : s_scales) {
+                const QImage source = createShadow(radius, scale, format);
+                const int scaledRadius = std::round(radius * scale);
+
+                QImage reference;
+                const qreal strided = measure(source, reference, iterations, [&](uint8_t *alpha, int pixelStride, int bytesPerLine, int width, int height) {
+                    stridedBoxBlurAlpha(alpha, pixelStride, bytesPerLine, width, height, scaledRadius);
+                });
+
+                out << formatName(format) << '\t' << radius << '\t' << scale << '\t' << std::ceil(source.width() * 0.5) << 'x' << std::ceil(source.height() * 0.5) << '\t' << strided;
+
+                qreal best = strided;
+                for (int kernel = 0; kernel < kernels; ++kernel) {
+                    QImage result;
+                    const qreal tiled = measure(source, result, iterations, [&](uint8_t *alpha, int pixelStride, int bytesPerLine, int width, int height) {
+                        boxBlurAlpha(alpha, pixelStride, bytesPerLine, width, height, scaledRadius, BoxBlurKernel(kernel));
+                    });
+                    out << '\t' << tiled;
+                    best = qMin(best, tiled);
+
+                    // all implementations must agree byte for byte
+                    if (result != reference) {
+                        out << "\tMISMATCH " << s_kernelNames[kernel];
+                        ++mismatches;
+                    }
+                }
+
+                out << '\t' << strided / best << "x\n";
+            }
+        }
+    }
+
+    // the analytic generator is an approximation of the same gaussian, report how far it is off
+    out << "\nradius\tbox blur us\tanalytic us\tspeedup\tmax error\n";
+    for (int radius : s_radii) {
+        QImage boxBlur;
+        QImage analytic;
+        const qreal boxBlurTime = measureGenerator(radius, BoxShadowRenderer::Generator::BoxBlur, iterations, boxBlur);
+        const qreal analyticTime = measureGenerator(radius, BoxShadowRenderer::Generator::Analytic, iterations, analytic);
+        out << radius << '\t' << boxBlurTime << '\t' << analyticTime << '\t' << boxBlurTime / analyticTime << "x\t"
+            << maximumAlphaError(boxBlur, analytic) << "/255\n";
+    }
+
+    if (mismatches) {
+        out << '\n' << mismatches << " mismatches\n";
+    }
+
+    return mismatches ? 1 : 0;
+}
@@ -21,13 +21,13 @@
 
 #pragma once
 
+#include "breezebuttonstyle.h"
 #include "breezedecoration.h"
 #include <KDecoration3/DecorationButton>
 
 #include <QHash>
 #include <QImage>
-
-class QVariantAnimation;
+#include <QPointer>
 
 namespace Breeze
 {
@@ -42,7 +42,7 @@ namespace Breeze
         explicit Button(QObject *parent, const QVariantList &args);
 
         //* destructor
-        virtual ~Button() = default;
+        ~Button() override;
 
         //* button creation
         static Button *create(KDecoration3::DecorationButtonType type, KDecoration3::Decoration *decoration, QObject *parent);
@@ -68,18 +68,20 @@ namespace Breeze
             m_padding.setRight(value);
         }
 
-        //*@name active state change animation
+        //*@name hover animation
         //@{
-        void setOpacity(qreal value)
+
+        //* true while the hover animation runs
+        bool isAnimating() const
         {
-            if (m_opacity == value) return;
-            m_opacity = value;
-            update();
+            return m_animating;
         }
 
-        qreal opacity() const
+        //* hover animation state, set by ButtonAnimator without triggering a repaint
+        void setAnimationState(bool running, qreal value)
         {
-            return m_opacity;
+            m_animating = running;
+            m_opacity = value;
         }
 
         //@}
@@ -102,39 +104,40 @@ namespace Breeze
         //* animation state
         void updateAnimationState(bool);
 
+        //* resolve colors on palette and active state changes
+        void updatePalette();
+
         private:
 
         //* private constructor
         explicit Button(KDecoration3::DecorationButtonType type, Decoration *decoration, QObject *parent = nullptr);
 
-        //* draw button icon
-        void drawIcon(QPainter *) const;
-        void drawIconPlasma( QPainter *) const;
-        void drawIconAqua( QPainter *) const;
-        void drawIconSunken( QPainter *) const;
-        void drawIconMacSymbols( QPainter *) const;
-        void drawIconOxygen( QPainter *) const;
+        //* current ButtonRenderState flags, without the color flags
+        int renderFlags() const;
 
+        //* render button icon using the display list of the configured style
+        void renderIcon(QPainter *, ButtonRenderState) const;
 
-        //* generic outer glow (to be stored in tilesets)
+        //* decoration
+        QPointer<Decoration> m_decoration;
 
-        void drawOuterGlow(QPainter *, const QColor&, int size) const;
+        //* title bar colors
+        ButtonTitleBarColors m_palette;
 
-        //* generic outer shadow (to be stored in tilesets)
-        void drawShadow(QPainter *painter, const QColor& color, int value) const;
-       // void drawShadow(QPainter *, const QColor&, int size);
+        //* compiled style
+        ButtonStyle m_style;
 
+        //* hover animations are enabled
+        bool m_animationsEnabled = true;
 
-        //*@name colors
-        //@{
-        QColor alphaColor(QColor color, qreal alpha) const;
-        QColor foregroundColor(const QColor& inactiveCol) const;
-        QColor backgroundColor() const;
+        //* hover animation duration (ms)
+        int m_animationDuration = 0;
 
-        //@}
+        //* number of cached hover animation frames
+        int m_animationSteps = 0;
 
-        //* active state change animation
-        QVariantAnimation *m_animation;
+        //* true while the hover animation runs
+        bool m_animating = false;
 
         //* padding (for rendering)
         QMargins m_padding;
@@ -142,7 +145,7 @@ namespace Breeze
         //* implicit size
         QSizeF m_preferredSize;
 
-        //* active state change opacity
+        //* hover animation value, in [0, 1]
         qreal m_opacity = 0;
     };
 
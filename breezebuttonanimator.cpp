@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezebuttonanimator.h"
+
+#include "breezebutton.h"
+#include "breezebuttoncache.h"
+
+#include <KDecoration3/Decoration>
+
+namespace Breeze
+{
+
+    ButtonAnimator *ButtonAnimator::s_self = nullptr;
+
+    //__________________________________________________________________
+    ButtonAnimator::ButtonAnimator():
+        m_easingCurve(QEasingCurve::InOutQuad)
+    {}
+
+    //__________________________________________________________________
+    ButtonAnimator::~ButtonAnimator()
+    { s_self = nullptr; }
+
+    //__________________________________________________________________
+    ButtonAnimator *ButtonAnimator::self()
+    {
+        if (!s_self)
+        { s_self = new ButtonAnimator(); }
+
+        return s_self;
+    }
+
+    //__________________________________________________________________
+    void ButtonAnimator::animate(Button *button, bool forward, int duration)
+    {
+        auto it = m_animations.find(button);
+        if (it == m_animations.end())
+        {
+            // a new animation starts from the end opposite to its direction
+            AnimationState animation;
+            animation.progress = forward ? 0 : 1;
+            it = m_animations.insert(button, animation);
+        }
+
+        // a running animation is simply reversed from where it is
+        it->forward = forward;
+        it->duration = qMax(1, duration);
+        button->setAnimationState(true, m_easingCurve.valueForProgress(it->progress));
+
+        if (state() != QAbstractAnimation::Running)
+        {
+            m_lastTime = 0;
+            start();
+        }
+    }
+
+    //__________________________________________________________________
+    void ButtonAnimator::remove(Button *button)
+    {
+        m_animations.remove(button);
+        if (m_animations.isEmpty() && state() == QAbstractAnimation::Running)
+            stop();
+    }
+
+    //__________________________________________________________________
+    void ButtonAnimator::updateCurrentTime(int currentTime)
+    {
+        const int elapsed = currentTime - m_lastTime;
+        m_lastTime = currentTime;
+        if (elapsed <= 0) return;
+
+        // damaged area of each decoration
+        QHash<KDecoration3::Decoration*, QRectF> damage;
+
+        for (auto it = m_animations.begin(); it != m_animations.end();)
+        {
+            Button *button = it.key();
+            AnimationState &animation = it.value();
+
+            const qreal step = static_cast<qreal>(elapsed)/animation.duration;
+            animation.progress = qBound<qreal>(0, animation.progress + (animation.forward ? step : -step), 1);
+            const bool finished = animation.forward ? animation.progress >= 1 : animation.progress <= 0;
+
+            button->setAnimationState(!finished, m_easingCurve.valueForProgress(animation.progress));
+
+            if (KDecoration3::Decoration *decoration = button->decoration())
+            {
+                // some styles paint slightly outside of the button
+                const QRectF rect = button->geometry();
+                const qreal margin = ButtonCache::margin(rect.size());
+                damage[decoration] |= rect.adjusted(-margin, -margin, margin, margin);
+            }
+
+            if (finished) it = m_animations.erase(it);
+            else ++it;
+        }
+
+        // one repaint per decoration
+        for (auto it = damage.constBegin(); it != damage.constEnd(); ++it)
+        { it.key()->update(it.value()); }
+
+        if (m_animations.isEmpty()) stop();
+    }
+
+}
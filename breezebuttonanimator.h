@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QAbstractAnimation>
+#include <QEasingCurve>
+#include <QHash>
+
+namespace Breeze
+{
+
+    class Button;
+
+    //* single process-wide driver for all button hover animations
+    /**
+    it is advanced by Qt's unified animation timer, so all buttons move in the same frame,
+    and repaint requests are merged into one update per decoration and frame.
+    Per-button state only exists while that button animates.
+    */
+    class ButtonAnimator: public QAbstractAnimation
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //* destructor
+        ~ButtonAnimator() override;
+
+        //* singleton
+        static ButtonAnimator *self();
+
+        //* start the hover animation of a button, or reverse it if already running
+        void animate(Button *button, bool forward, int duration);
+
+        //* forget about a button, e.g. when it is deleted
+        void remove(Button *button);
+
+        //* runs as long as any button animates
+        int duration() const override
+        { return -1; }
+
+        protected:
+
+        //* advance all running animations
+        void updateCurrentTime(int currentTime) override;
+
+        private:
+
+        //* constructor
+        ButtonAnimator();
+
+        //* state of one running animation
+        struct AnimationState
+        {
+            //* linear progress, in [0, 1]
+            qreal progress = 0;
+
+            //* duration of a full animation (ms)
+            int duration = 1;
+
+            bool forward = true;
+        };
+
+        //* running animations
+        QHash<Button*, AnimationState> m_animations;
+
+        //* easing applied to the linear progress
+        QEasingCurve m_easingCurve;
+
+        //* time of the last tick
+        int m_lastTime = 0;
+
+        //* singleton
+        static ButtonAnimator *s_self;
+
+    };
+
+}
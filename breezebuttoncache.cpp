@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezebuttoncache.h"
+
+#include <QHashFunctions>
+
+#include <cmath>
+
+namespace Breeze
+{
+
+    //* upper bound for the memory used by sprites (bytes)
+    static constexpr int s_maxSpriteCost = 16*1024*1024;
+
+    ButtonCache *ButtonCache::s_self = nullptr;
+
+    //__________________________________________________________________
+    size_t qHash(const ButtonSpriteKey &key, size_t seed) noexcept
+    {
+        // sizes are hashed with 1/64 pixel precision, which is finer than any geometry we get
+        return qHashMulti(seed,
+                          key.style, key.type, key.state, key.frame, key.animationsEnabled,
+                          qRound(key.size.width()*64), qRound(key.size.height()*64),
+                          qRound(key.scale*64),
+                          key.titleBarColor, key.fontColor, key.warningColor, key.hoveredWarningColor);
+    }
+
+    //__________________________________________________________________
+    ButtonCache::ButtonCache():
+        m_sprites(s_maxSpriteCost)
+    {}
+
+    //__________________________________________________________________
+    ButtonCache::~ButtonCache()
+    { s_self = nullptr; }
+
+    //__________________________________________________________________
+    ButtonCache *ButtonCache::self()
+    {
+        if (!s_self)
+        { s_self = new ButtonCache(); }
+
+        return s_self;
+    }
+
+    //__________________________________________________________________
+    QImage ButtonCache::sprite(const ButtonSpriteKey &key) const
+    {
+        if (const QImage *image = m_sprites.object(key))
+            return *image;
+        return QImage();
+    }
+
+    //__________________________________________________________________
+    void ButtonCache::insert(const ButtonSpriteKey &key, const QImage &sprite)
+    {
+        if (sprite.isNull()) return;
+        m_sprites.insert(key, new QImage(sprite), qMax<qsizetype>(1, sprite.sizeInBytes()));
+    }
+
+    //__________________________________________________________________
+    int ButtonCache::spriteFrame(qreal opacity, int steps)
+    { return 1 + qRound(opacity*(steps - 1)); }
+
+    //__________________________________________________________________
+    qreal ButtonCache::spriteProgress(int flags, int frame, int steps, bool animationsEnabled)
+    {
+        if (frame > 0) return static_cast<qreal>(frame - 1)/(steps - 1);
+        else if (!animationsEnabled) return 0;
+        return (flags & (ButtonRenderState::Hovered|ButtonRenderState::Pressed)) ? 1 : 0;
+    }
+
+    //__________________________________________________________________
+    ButtonSpriteKey ButtonCache::spriteKey(const ButtonStyle &style, const ButtonTitleBarColors &palette, const ButtonRenderState &state, int frame, bool animationsEnabled, const QSizeF &size, qreal scale)
+    {
+        ButtonSpriteKey key;
+        key.style = style.style();
+        key.type = static_cast<int>(style.type());
+        key.state = state.flags;
+        key.frame = frame;
+        key.animationsEnabled = animationsEnabled;
+        key.size = size;
+        key.scale = scale;
+        key.titleBarColor = palette.titleBar.rgba();
+        key.fontColor = palette.font.rgba();
+        key.warningColor = palette.warning.rgba();
+        key.hoveredWarningColor = palette.hoveredWarning.rgba();
+        return key;
+    }
+
+    //__________________________________________________________________
+    qreal ButtonCache::margin(const QSizeF &size)
+    {
+        // the button styles map the button onto QRect(-1, -1, 20, 20) and the
+        // Oxygen glow covers QRect(0, 0, 21, 21) of it, i.e. up to 10% outside the button
+        return std::ceil(0.15*qMax(size.width(), size.height()));
+    }
+
+    //__________________________________________________________________
+    void ButtonCache::clear()
+    { m_sprites.clear(); }
+
+}
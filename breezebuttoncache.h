@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "breezebuttonstyle.h"
+
+#include <QCache>
+#include <QColor>
+#include <QImage>
+#include <QObject>
+#include <QSizeF>
+
+namespace Breeze
+{
+
+    //* everything a rendered button depends on
+    struct ButtonSpriteKey
+    {
+
+        int style = 0;
+        int type = 0;
+
+        //* ButtonRenderState flags
+        int state = 0;
+
+        //* quantized hover animation step, 0 when not animated
+        int frame = 0;
+
+        //* hover animations are enabled. Static hovered buttons depend on it
+        bool animationsEnabled = true;
+
+        //* button size, in logical pixels
+        QSizeF size;
+
+        //* device pixel ratio
+        qreal scale = 1;
+
+        //*@name title bar colors
+        //@{
+        QRgb titleBarColor = 0;
+        QRgb fontColor = 0;
+        QRgb warningColor = 0;
+        QRgb hoveredWarningColor = 0;
+        //@}
+
+        bool operator == (const ButtonSpriteKey &other) const
+        {
+            return style == other.style
+                && type == other.type
+                && state == other.state
+                && frame == other.frame
+                && animationsEnabled == other.animationsEnabled
+                && size == other.size
+                && scale == other.scale
+                && titleBarColor == other.titleBarColor
+                && fontColor == other.fontColor
+                && warningColor == other.warningColor
+                && hoveredWarningColor == other.hoveredWarningColor;
+        }
+
+    };
+
+    size_t qHash(const ButtonSpriteKey &key, size_t seed = 0) noexcept;
+
+    //* process-wide cache of rasterized buttons, shared by all decorations
+    class ButtonCache: public QObject
+    {
+
+        Q_OBJECT
+
+        public:
+
+        //* destructor
+        ~ButtonCache() override;
+
+        //* singleton
+        static ButtonCache *self();
+
+        //* sprite for given key, or a null image if not rendered yet
+        QImage sprite(const ButtonSpriteKey &key) const;
+
+        //* store a freshly rendered sprite
+        void insert(const ButtonSpriteKey &key, const QImage &sprite);
+
+        //*@name sprite keys, shared by Button::paint and the benchmark
+        //@{
+
+        //* hover animation frame for given hover animation value, out of given number of steps
+        static int spriteFrame(qreal opacity, int steps);
+
+        //* hover animation value a sprite is rendered with
+        /**
+        a function of the key only: static sprites (frame 0) are fully hovered or not hovered at all.
+        Without animations the hover animation value never leaves 0, hovered or not
+        */
+        static qreal spriteProgress(int flags, int frame, int steps, bool animationsEnabled);
+
+        //* key of the sprite of a button rendered in given state
+        static ButtonSpriteKey spriteKey(const ButtonStyle &style, const ButtonTitleBarColors &palette, const ButtonRenderState &state, int frame, bool animationsEnabled, const QSizeF &size, qreal scale);
+
+        //@}
+
+        //* margin around the button rect that a sprite covers, in logical pixels
+        /** some styles (e.g. Oxygen glow) paint slightly outside of the button rect */
+        static qreal margin(const QSizeF &size);
+
+        public Q_SLOTS:
+
+        //* drop all sprites, on reconfiguration
+        void clear();
+
+        private:
+
+        //* constructor
+        ButtonCache();
+
+        //* sprites, cost is their size in bytes
+        QCache<ButtonSpriteKey, QImage> m_sprites;
+
+        //* singleton
+        static ButtonCache *s_self;
+
+    };
+
+}
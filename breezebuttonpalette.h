@@ -0,0 +1,176 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <KDecoration3/DecorationButton>
+
+#include <QColor>
+
+namespace Breeze
+{
+
+    //* compile time button colors
+    /**
+    only the base colors are tabulated. Their QColor::lighter and darker shades are derived
+    once per button, when the style is created or the title bar color changes, rather than on paint.
+    Tables with a light/dark index use 0 for dark and 1 for light title bars.
+    */
+    namespace ButtonPalette
+    {
+
+        //* groups of button types that share colors
+        enum Slot
+        {
+            Close,
+            Maximize,
+            Minimize,
+            Toggle,
+            ApplicationMenu,
+            ContextHelp,
+            SlotCount
+        };
+
+        //* slot of a button type
+        inline Slot slot(KDecoration3::DecorationButtonType type)
+        {
+            switch (type)
+            {
+                case KDecoration3::DecorationButtonType::Close: return Close;
+                case KDecoration3::DecorationButtonType::Maximize: return Maximize;
+                case KDecoration3::DecorationButtonType::Minimize: return Minimize;
+                case KDecoration3::DecorationButtonType::ApplicationMenu: return ApplicationMenu;
+                case KDecoration3::DecorationButtonType::ContextHelp: return ContextHelp;
+                default: return Toggle;
+            }
+        }
+
+        //* colors of a slot, 0 when not used
+        struct SlotColors
+        {
+            QRgb base;
+
+            //*@name vertical gradient
+            //@{
+            QRgb top;
+            QRgb bottom;
+            QRgb checkedTop;
+            QRgb checkedBottom;
+            //@}
+        };
+
+        //*@name slot colors
+        //@{
+        static constexpr SlotColors CloseColors = {
+            qRgb(255, 92, 87), qRgb(255, 92, 87), qRgb(233, 84, 79), 0, 0 };
+
+        static constexpr SlotColors MaximizeColors = {
+            qRgb(36, 191, 57), qRgb(40, 211, 63), qRgb(36, 191, 57), qRgb(67, 198, 176), qRgb(60, 178, 159) };
+
+        static constexpr SlotColors MinimizeColors = {
+            qRgb(243, 176, 43), qRgb(243, 176, 43), qRgb(223, 162, 39), 0, 0 };
+
+        static constexpr SlotColors ToggleColors = {
+            qRgb(103, 149, 210), qRgb(103, 149, 210), qRgb(93, 135, 190), 0, 0 };
+
+        static constexpr SlotColors ApplicationMenuColors = {
+            qRgb(230, 129, 67), qRgb(230, 129, 67), qRgb(210, 118, 61), 0, 0 };
+
+        //* Sunken toggle buttons are lighter and have no gradient
+        static constexpr SlotColors SunkenToggleColors = {
+            qRgb(132, 165, 202), 0, 0, 0, 0 };
+        //@}
+
+        //*@name per style slot colors
+        //@{
+        static constexpr SlotColors MacSymbols[SlotCount] = {
+            CloseColors, MaximizeColors, MinimizeColors, ToggleColors, ApplicationMenuColors, ToggleColors };
+
+        static constexpr SlotColors Aqua[SlotCount] = {
+            CloseColors, MaximizeColors, MinimizeColors, ToggleColors, ApplicationMenuColors, ApplicationMenuColors };
+
+        static constexpr SlotColors Sunken[SlotCount] = {
+            CloseColors, MaximizeColors, MinimizeColors, SunkenToggleColors, ApplicationMenuColors, ApplicationMenuColors };
+
+        static constexpr QRgb OxygenGlow[SlotCount] = {
+            qRgb(191, 3, 3), qRgb(36, 191, 57), qRgb(243, 176, 43), qRgb(142, 203, 233), qRgb(142, 203, 233), qRgb(142, 203, 233) };
+        //@}
+
+        //* symbol color of MacSymbols, Aqua and Sunken
+        static constexpr QRgb Symbol = qRgb(34, 45, 50);
+
+        //* Oxygen bevel and symbol colors
+        struct OxygenColors
+        {
+            //* bevel top. The rim goes from its lighter(110) to its darker(110) shade
+            QRgb light;
+
+            //* bevel bottom, before darker(130)
+            QRgb dark;
+
+            QRgb symbol;
+            QRgb symbolShadow;
+        };
+
+        static constexpr OxygenColors Oxygen[2] = {
+            { qRgb(122, 122, 122), qRgb(92, 92, 92), qRgb(255, 255, 255), qRgb(0, 0, 0) },
+            { qRgb(255, 255, 255), qRgb(239, 240, 241), qRgb(0, 0, 0), qRgb(255, 255, 255) } };
+
+        //* groups of button types that share pressed and hovered background colors
+        enum BackgroundSlot
+        {
+            CloseBackground,
+            MaximizeBackground,
+            RestoreBackground,
+            MinimizeBackground,
+            ApplicationMenuBackground,
+            OtherBackground,
+            BackgroundSlotCount
+        };
+
+        //*@name MacSymbols, Aqua and Sunken backgrounds, by slot and title bar lightness
+        //@{
+        static constexpr QRgb PressedBackground[BackgroundSlotCount][2] = {
+            { qRgb(240, 77, 80), qRgb(254, 73, 66) },
+            { qRgb(101, 188, 34), qRgb(7, 201, 33) },
+            { qRgb(0, 188, 154), qRgb(0, 188, 154) },
+            { qRgb(227, 185, 59), qRgb(233, 160, 13) },
+            { qRgb(240, 139, 96), qRgb(220, 124, 64) },
+            { qRgb(110, 136, 180), qRgb(83, 121, 170) } };
+
+        static constexpr QRgb HoveredBackground[BackgroundSlotCount][2] = {
+            { qRgb(240, 96, 97), qRgb(254, 95, 87) },
+            { qRgb(116, 188, 64), qRgb(39, 201, 63) },
+            { qRgb(64, 188, 168), qRgb(64, 188, 168) },
+            { qRgb(227, 191, 78), qRgb(233, 172, 41) },
+            { qRgb(240, 139, 96), qRgb(220, 124, 64) },
+            { qRgb(128, 157, 210), qRgb(98, 141, 200) } };
+        //@}
+
+        //*@name Plasma backgrounds, by title bar lightness
+        //@{
+        static constexpr QRgb PlasmaPressedBackground[2] = { qRgba(255, 255, 255, 210), qRgba(0, 0, 0, 190) };
+        static constexpr QRgb PlasmaHoveredBackground[2] = { qRgba(255, 255, 255, 180), qRgba(0, 0, 0, 165) };
+        //@}
+
+    }
+
+}
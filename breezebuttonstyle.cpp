@@ -0,0 +1,826 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezebuttonstyle.h"
+
+#include "breeze.h"
+#include "breezebuttontilesets.h"
+
+#include <KColorUtils>
+
+#include <QLinearGradient>
+#include <QPainter>
+#include <QRadialGradient>
+
+#include <utility>
+
+namespace Breeze
+{
+
+    using KDecoration3::DecorationButtonType;
+
+    namespace
+    {
+
+        //*@name state flags, for readability of the tables below
+        //@{
+        constexpr int Hovered = ButtonRenderState::Hovered;
+        constexpr int Pressed = ButtonRenderState::Pressed;
+        constexpr int Checked = ButtonRenderState::Checked;
+        constexpr int Maximized = ButtonRenderState::Maximized;
+        constexpr int HasBackground = ButtonRenderState::HasBackground;
+        constexpr int HasForeground = ButtonRenderState::HasForeground;
+        //@}
+
+        //* layer conditions
+        struct Condition
+        {
+            int when = 0;
+            int unless = 0;
+            int any = 0;
+
+            Condition unlessSet(int flags) const
+            { Condition out(*this); out.unless |= flags; return out; }
+        };
+
+        Condition always()
+        { return Condition(); }
+
+        Condition when(int flags)
+        { Condition out; out.when = flags; return out; }
+
+        Condition unless(int flags)
+        { Condition out; out.unless = flags; return out; }
+
+        Condition anyOf(int flags)
+        { Condition out; out.any = flags; return out; }
+
+        //*@name paint helpers
+        //@{
+        ButtonColorRef ref(ButtonColor role)
+        {
+            ButtonColorRef out;
+            out.role = role;
+            return out;
+        }
+
+        ButtonColorRef literal(int r, int g, int b, int a = 255)
+        {
+            ButtonColorRef out;
+            out.role = ButtonColor::Literal;
+            out.rgba = qRgba(r, g, b, a);
+            return out;
+        }
+
+        ButtonPaint solid(const ButtonColorRef &color)
+        {
+            ButtonPaint out;
+            out.type = ButtonPaint::Solid;
+            out.color = color;
+            return out;
+        }
+
+        ButtonPaint solid(ButtonColor role)
+        { return solid(ref(role)); }
+
+        ButtonPaint gradient(const ButtonGradient &gradient)
+        {
+            ButtonPaint out;
+            out.type = ButtonPaint::Gradient;
+            out.gradient = &gradient;
+            return out;
+        }
+
+        ButtonGradient linear(const QPointF &start, const QPointF &end, const QVector<ButtonGradient::Stop> &stops)
+        {
+            ButtonGradient out;
+            out.type = ButtonGradient::Linear;
+            out.start = start;
+            out.end = end;
+            out.stops = stops;
+            return out;
+        }
+
+        ButtonGradient radial(const QPointF &center, qreal radius, const QPointF &focalPoint, const QVector<ButtonGradient::Stop> &stops)
+        {
+            ButtonGradient out;
+            out.type = ButtonGradient::Radial;
+            out.start = center;
+            out.end = focalPoint;
+            out.radius = radius;
+            out.stops = stops;
+            return out;
+        }
+        //@}
+
+        //*@name layer helpers
+        //@{
+        ButtonLayer layer(ButtonLayer::Shape shape, const Condition &condition)
+        {
+            ButtonLayer out;
+            out.shape = shape;
+            out.when = condition.when;
+            out.unless = condition.unless;
+            out.any = condition.any;
+            return out;
+        }
+
+        ButtonLayer ellipse(const QRectF &rect, const ButtonPaint &brush, const ButtonPaint &pen, const Condition &condition = always())
+        {
+            ButtonLayer out(layer(ButtonLayer::Ellipse, condition));
+            out.rect = rect;
+            out.brush = brush;
+            out.pen = pen;
+            return out;
+        }
+
+        ButtonLayer disk(qreal radius, qreal growth, const ButtonPaint &brush, const ButtonPaint &pen, const Condition &condition)
+        {
+            ButtonLayer out(layer(ButtonLayer::Disk, condition));
+            out.radius = radius;
+            out.growth = growth;
+            out.brush = brush;
+            out.pen = pen;
+            return out;
+        }
+
+        ButtonLayer glyph(ButtonGlyph glyph, const ButtonPaint &brush, const ButtonPaint &pen, qreal penScale, qreal penMinimum, const Condition &condition)
+        {
+            ButtonLayer out(layer(ButtonLayer::Glyph, condition));
+            out.glyph = glyph;
+            out.brush = brush;
+            out.pen = pen;
+            out.penScale = penScale;
+            out.penMinimum = penMinimum;
+            return out;
+        }
+
+        ButtonLayer glow(const Condition &condition)
+        {
+            ButtonLayer out(layer(ButtonLayer::Glow, condition));
+            out.rect = QRectF(0, 0, 21, 21);
+            out.brush = solid(ButtonColor::Glow);
+            return out;
+        }
+
+        ButtonLayer dropShadow(const Condition &condition)
+        {
+            ButtonLayer out(layer(ButtonLayer::DropShadow, condition));
+            out.rect = QRectF(0, 0, 21, 21);
+            out.brush = solid(literal(0, 0, 0));
+            return out;
+        }
+        //@}
+
+        //* no paint
+        const ButtonPaint noPaint = ButtonPaint();
+
+        //* true for the buttons that toggle a window property
+        bool isToggle(DecorationButtonType type)
+        {
+            return type == DecorationButtonType::OnAllDesktops
+                || type == DecorationButtonType::Shade
+                || type == DecorationButtonType::KeepBelow
+                || type == DecorationButtonType::KeepAbove;
+        }
+
+        //* keep below and keep above, which Plasma highlights while checked
+        bool isKeep(DecorationButtonType type)
+        { return type == DecorationButtonType::KeepBelow || type == DecorationButtonType::KeepAbove; }
+
+        //* MacSymbols, Aqua and Sunken glyph layers
+        void compileMacGlyphs(DecorationButtonType type, ButtonGlyph shadeGlyph, ButtonGlyph unshadeGlyph, qreal penScale, QVector<ButtonLayer> &layers)
+        {
+            const ButtonPaint symbol = solid(ButtonColor::Symbol);
+            switch (type)
+            {
+                case DecorationButtonType::Close:
+                layers << glyph(ButtonGlyph::MacClose, noPaint, symbol, penScale, 1, when(Hovered));
+                break;
+
+                case DecorationButtonType::Maximize:
+                layers << glyph(ButtonGlyph::MacRestore, symbol, noPaint, 0, 1, when(Hovered|Checked));
+                layers << glyph(ButtonGlyph::MacMaximize, symbol, noPaint, 0, 1, when(Hovered).unlessSet(Checked));
+                break;
+
+                case DecorationButtonType::Minimize:
+                layers << glyph(ButtonGlyph::MacMinimize, noPaint, symbol, 24, 1.2, when(Hovered));
+                break;
+
+                case DecorationButtonType::OnAllDesktops:
+                layers << glyph(ButtonGlyph::MacOnAllDesktops, noPaint, symbol, penScale, 1, anyOf(Pressed|Hovered|Checked));
+                break;
+
+                case DecorationButtonType::Shade:
+                layers << glyph(unshadeGlyph, noPaint, symbol, penScale, 1, when(Checked));
+                layers << glyph(shadeGlyph, noPaint, symbol, penScale, 1, anyOf(Pressed|Hovered).unlessSet(Checked));
+                break;
+
+                case DecorationButtonType::KeepBelow:
+                layers << glyph(ButtonGlyph::MacKeepBelow, noPaint, symbol, penScale, 1, anyOf(Pressed|Hovered|Checked));
+                break;
+
+                case DecorationButtonType::KeepAbove:
+                layers << glyph(ButtonGlyph::MacKeepAbove, noPaint, symbol, penScale, 1, anyOf(Pressed|Hovered|Checked));
+                break;
+
+                case DecorationButtonType::ApplicationMenu:
+                layers << glyph(ButtonGlyph::MacApplicationMenu, noPaint, symbol, penScale, 1, anyOf(Pressed|Hovered));
+                break;
+
+                case DecorationButtonType::ContextHelp:
+                layers << glyph(ButtonGlyph::MacContextHelp, noPaint, symbol, penScale, 1, anyOf(Pressed|Hovered));
+                break;
+
+                default: break;
+            }
+        }
+
+        //* MacSymbols: gradient disk, with a background disk growing on hover
+        void compileMacSymbols(DecorationButtonType type, QVector<ButtonLayer> &layers)
+        {
+            static const ButtonGradient fill = linear(QPointF(9, 2), QPointF(9, 16), {
+                { 0, ref(ButtonColor::GradientTop) },
+                { 1, ref(ButtonColor::GradientBottom) } });
+
+            const ButtonPaint outline = solid(ButtonColor::BaseOutline);
+            const ButtonPaint background = solid(ButtonColor::Background);
+
+            switch (type)
+            {
+                case DecorationButtonType::Close:
+                case DecorationButtonType::Maximize:
+                case DecorationButtonType::Minimize:
+                layers << ellipse(QRectF(1, 1, 16, 16), gradient(fill), outline);
+                layers << disk(7, 0, background, outline, when(HasBackground|Pressed));
+                layers << disk(7, 2, background, outline, when(HasBackground).unlessSet(Pressed));
+                break;
+
+                case DecorationButtonType::OnAllDesktops:
+                case DecorationButtonType::Shade:
+                case DecorationButtonType::KeepBelow:
+                case DecorationButtonType::KeepAbove:
+                layers << ellipse(QRectF(0, 0, 18, 18), gradient(fill), outline, when(Checked).unlessSet(Pressed));
+                layers << ellipse(QRectF(1, 1, 16, 16), gradient(fill), outline, unless(Pressed|Checked));
+                layers << disk(7, 2, background, outline, when(HasBackground).unlessSet(Pressed|Checked));
+                layers << ellipse(QRectF(0, 0, 18, 18), background, outline, when(HasBackground|Pressed));
+                break;
+
+                case DecorationButtonType::ApplicationMenu:
+                case DecorationButtonType::ContextHelp:
+                layers << ellipse(QRectF(1, 1, 16, 16), gradient(fill), outline, unless(Pressed));
+                layers << disk(7, 2, background, outline, when(HasBackground).unlessSet(Pressed));
+                layers << ellipse(QRectF(0, 0, 18, 18), background, outline, when(HasBackground|Pressed));
+                break;
+
+                default: return;
+            }
+
+            compileMacGlyphs(type, ButtonGlyph::MacShade, ButtonGlyph::MacUnshade, 2.1*21, layers);
+        }
+
+        //* Aqua: glossy bead
+        void compileAqua(DecorationButtonType type, QVector<ButtonLayer> &layers)
+        {
+            static const ButtonGradient bead = radial(QPointF(9, 9), 9, QPointF(9, 18), {
+                { 0, ref(ButtonColor::BaseLight) },
+                { 0.6, ref(ButtonColor::Base) },
+                { 1, ref(ButtonColor::BaseDark) } });
+
+            static const ButtonGradient gloss = linear(QPointF(4, 1), QPointF(4, 1 + 18/2.5), {
+                { 0, literal(255, 255, 255, 180) },
+                { 1, literal(255, 255, 255, 0) } });
+
+            static const ButtonGradient bevel = radial(QPointF(9, 9), 9, QPointF(9, 9), {
+                { 0, literal(255, 255, 255, 0) },
+                { 1, literal(255, 255, 255, 55) } });
+
+            if (type == DecorationButtonType::Menu || type == DecorationButtonType::Custom || type == DecorationButtonType::Spacer) return;
+
+            // the bead is painted a second time over hovered and pressed buttons, which doubles the translucent gloss
+            for (const Condition &condition : { always(), when(HasBackground) })
+            {
+                layers << ellipse(QRectF(0, 0, 18, 18), gradient(bead), solid(ButtonColor::BaseOutline), condition);
+                layers << ellipse(QRectF(4, 1, 10, 18/2.5), gradient(gloss), noPaint, condition);
+                layers << ellipse(QRectF(2, 18/1.9, 14, 18/2.2), gradient(bevel), noPaint, condition);
+            }
+
+            compileMacGlyphs(type, ButtonGlyph::AquaShade, ButtonGlyph::AquaShade, 1.8*21, layers);
+        }
+
+        //* Sunken: flat disk with inner shadow
+        void compileSunken(DecorationButtonType type, QVector<ButtonLayer> &layers)
+        {
+            // the inner shadow of the window operation buttons is lower
+            static const QVector<ButtonGradient::Stop> innerShadowStops = {
+                { 0, literal(0, 0, 0, 0) },
+                { 0.4, literal(0, 0, 0, 10) },
+                { 0.8, literal(0, 0, 0, 70) },
+                { 0.95, literal(0, 0, 0, 120) },
+                { 1, literal(0, 0, 0, 120) } };
+            static const ButtonGradient innerShadow = radial(QPointF(9, 9 + 18*0.15), 9, QPointF(9, 9 + 18*0.15), innerShadowStops);
+            static const ButtonGradient innerShadowHigh = radial(QPointF(9, 9 + 18*0.10), 9, QPointF(9, 9 + 18*0.10), innerShadowStops);
+
+            static const ButtonGradient pressedShadow = linear(QPointF(0, 0), QPointF(0, 18), {
+                { 0, literal(0, 0, 0, 70) },
+                { 0.5, literal(0, 0, 0, 20) },
+                { 1, literal(0, 0, 0, 0) } });
+
+            if (type == DecorationButtonType::Menu || type == DecorationButtonType::Custom || type == DecorationButtonType::Spacer) return;
+
+            const bool windowOperation = !isToggle(type)
+                && type != DecorationButtonType::ApplicationMenu
+                && type != DecorationButtonType::ContextHelp;
+
+            // hovered and pressed buttons get a second disk, with the pressed shadow, over the first one
+            const QRectF rect(0, 0, 18, 18);
+            layers << ellipse(rect, solid(ButtonColor::Base), noPaint);
+            layers << ellipse(rect, gradient(windowOperation ? innerShadow : innerShadowHigh), noPaint);
+            layers << ellipse(rect, noPaint, solid(literal(0, 0, 0, 100)));
+            layers << ellipse(rect, solid(ButtonColor::Base), noPaint, when(HasBackground));
+            layers << ellipse(rect, gradient(pressedShadow), noPaint, when(HasBackground));
+            layers << ellipse(rect, noPaint, solid(literal(0, 0, 0, 100)), when(HasBackground));
+
+            compileMacGlyphs(type, ButtonGlyph::AquaShade, ButtonGlyph::AquaShade, 2.1*21, layers);
+        }
+
+        //* Plasma: flat symbols, as Breeze
+        void compilePlasma(DecorationButtonType type, QVector<ButtonLayer> &layers)
+        {
+            using G = ButtonGlyph;
+
+            const ButtonPaint foreground = solid(ButtonColor::Foreground);
+            const qreal penScale = PenWidth::Symbol*20;
+            const qreal penMinimum = PenWidth::Symbol;
+            auto stroke = [&](ButtonGlyph symbol, const Condition &condition = always())
+            {
+                ButtonLayer out(glyph(symbol, noPaint, foreground, penScale, penMinimum, condition));
+                out.when |= HasForeground;
+                out.roundCap = true;
+                return out;
+            };
+
+            auto fill = [&](ButtonGlyph symbol, const ButtonPaint &brush, const Condition &condition)
+            {
+                ButtonLayer out(glyph(symbol, brush, noPaint, 0, 0, condition));
+                out.when |= HasForeground;
+                return out;
+            };
+
+            layers << ellipse(QRectF(0, 0, 18, 18), solid(ButtonColor::Background), noPaint, when(HasBackground));
+
+            switch (type)
+            {
+                case DecorationButtonType::Close: layers << stroke(G::PlasmaClose); break;
+                case DecorationButtonType::Maximize: layers << stroke(G::PlasmaMaximize); break;
+                case DecorationButtonType::Minimize: layers << stroke(G::PlasmaMinimize); break;
+
+                case DecorationButtonType::OnAllDesktops:
+                layers << fill(G::PlasmaPinnedRing, foreground, when(Checked));
+                layers << fill(G::PlasmaPinnedDot, solid(ButtonColor::BackgroundOrTitleBar), when(Checked));
+                layers << fill(G::PlasmaPinHead, foreground, unless(Checked));
+                layers << stroke(G::PlasmaPinNeedle, unless(Checked));
+                break;
+
+                case DecorationButtonType::Shade:
+                layers << stroke(G::PlasmaUnshade, when(Checked));
+                layers << stroke(G::PlasmaShade, unless(Checked));
+                break;
+
+                case DecorationButtonType::KeepBelow: layers << stroke(G::PlasmaKeepBelow); break;
+                case DecorationButtonType::KeepAbove: layers << stroke(G::PlasmaKeepAbove); break;
+                case DecorationButtonType::ApplicationMenu: layers << stroke(G::PlasmaApplicationMenu); break;
+                case DecorationButtonType::ContextHelp: layers << stroke(G::PlasmaContextHelp); break;
+                default: break;
+            }
+        }
+
+        //* Oxygen: bevelled disk with glow on hover
+        void compileOxygen(DecorationButtonType type, QVector<ButtonLayer> &layers)
+        {
+            using G = ButtonGlyph;
+
+            // bevel gradient, reversed for sunken buttons. It is slightly shorter for some types
+            auto bevel = [](qreal bottom, bool sunken)
+            {
+                const ButtonColorRef light = ref(ButtonColor::Light);
+                const ButtonColorRef dark = ref(ButtonColor::Dark);
+                return linear(QPointF(0, 3), QPointF(0, bottom), {
+                    { 0, sunken ? dark : light },
+                    { 1, sunken ? light : dark } });
+            };
+
+            static const ButtonGradient raised = bevel(14.5 + 3, false);
+            static const ButtonGradient sunken = bevel(14.5 + 3, true);
+            static const ButtonGradient raisedShort = bevel(14.5 + 2.7, false);
+            static const ButtonGradient sunkenShort = bevel(14.5 + 2.7, true);
+
+            // rim gradient. It is also slightly shorter for some types, on the first pass only
+            auto rimGradient = [](qreal bottom)
+            {
+                return linear(QPointF(0, 3), QPointF(0, bottom), {
+                    { 0, ref(ButtonColor::RimTop) },
+                    { 1, ref(ButtonColor::RimBottom) } });
+            };
+
+            static const ButtonGradient outline = rimGradient(2*14.5 + 3);
+            static const ButtonGradient outlineShort = rimGradient(2*14.5 + 2.7);
+
+            struct Symbol { G glyph; G shadow; Condition condition; };
+            QVector<Symbol> symbols;
+            switch (type)
+            {
+                case DecorationButtonType::Close:
+                symbols = { { G::OxygenClose, G::OxygenCloseShadow, always() } };
+                break;
+
+                case DecorationButtonType::Maximize:
+                symbols = {
+                    { G::OxygenRestore, G::OxygenRestoreShadow, when(Maximized) },
+                    { G::OxygenMaximize, G::OxygenMaximizeShadow, unless(Maximized) } };
+                break;
+
+                case DecorationButtonType::Minimize:
+                symbols = { { G::OxygenMinimize, G::OxygenMinimizeShadow, always() } };
+                break;
+
+                case DecorationButtonType::OnAllDesktops:
+                symbols = { { G::OxygenOnAllDesktops, G::OxygenOnAllDesktopsShadow, always() } };
+                break;
+
+                case DecorationButtonType::KeepBelow:
+                symbols = { { G::OxygenKeepBelow, G::OxygenKeepBelowShadow, always() } };
+                break;
+
+                case DecorationButtonType::KeepAbove:
+                symbols = { { G::OxygenKeepAbove, G::OxygenKeepAboveShadow, always() } };
+                break;
+
+                case DecorationButtonType::ApplicationMenu:
+                symbols = { { G::OxygenApplicationMenu, G::OxygenApplicationMenuShadow, always() } };
+                break;
+
+                case DecorationButtonType::ContextHelp:
+                symbols = { { G::MacContextHelp, G::MacContextHelp, always() } };
+                break;
+
+                // there is no Oxygen shade button
+                default: return;
+            }
+
+            const bool windowOperation =
+                type == DecorationButtonType::Close
+                || type == DecorationButtonType::Maximize
+                || type == DecorationButtonType::Minimize
+                || type == DecorationButtonType::OnAllDesktops;
+
+            // the glow replaces the shadow of close and maximize buttons
+            if (type == DecorationButtonType::Close || type == DecorationButtonType::Maximize) layers << dropShadow(unless(Hovered));
+            else layers << dropShadow(always());
+            layers << glow(when(Hovered));
+
+            // bevel and rim are painted twice, the second bevel with the pen of the first rim.
+            // This strengthens the thin rim and the antialiased edges. For types other than window
+            // operations, the short gradients are swapped between the two passes
+            struct Pass { const ButtonGradient *raised; const ButtonGradient *sunken; const ButtonGradient *rim; ButtonPaint bevelPen; };
+            const Pass passes[] = {
+                { &raised, &sunken, windowOperation ? &outline : &outlineShort, noPaint },
+                { windowOperation ? &raised : &raisedShort, windowOperation ? &sunken : &sunkenShort, &outline, gradient(windowOperation ? outline : outlineShort) } };
+
+            for (const Pass &pass : passes)
+            {
+                ButtonLayer raisedBevel(ellipse(QRectF(3.3, 3, 14.5, 14.5), gradient(*pass.raised), pass.bevelPen, unless(Pressed|Checked)));
+                ButtonLayer sunkenBevel(ellipse(QRectF(3.3, 3, 14.5, 14.5), gradient(*pass.sunken), pass.bevelPen, anyOf(Pressed|Checked)));
+                ButtonLayer rim(ellipse(QRectF(3.5, 3.2, 14.3, 14.3), noPaint, gradient(*pass.rim)));
+                raisedBevel.penMinimum = sunkenBevel.penMinimum = rim.penMinimum = 0.2;
+                layers << raisedBevel << sunkenBevel << rim;
+            }
+
+            const qreal glowScale = type == DecorationButtonType::Close ? 1.5*21 : 2.1*21;
+            for (const Symbol &symbol : std::as_const(symbols))
+            {
+                layers << glyph(symbol.shadow, solid(ButtonColor::SymbolShadow), solid(ButtonColor::SymbolShadow), 1.5*21, 1, symbol.condition);
+                layers << glyph(symbol.glyph, solid(ButtonColor::Symbol), solid(ButtonColor::Symbol), 1.5*21, 1, symbol.condition);
+
+                ButtonLayer hover(glyph(symbol.glyph, solid(ButtonColor::Glow), solid(ButtonColor::Glow), glowScale, 1, symbol.condition));
+                hover.when |= Hovered;
+                layers << hover;
+            }
+        }
+
+        //* resolved color
+        QColor resolve(const ButtonColorRef &ref, const QColor *colors)
+        {
+            return ref.role == ButtonColor::Literal ? QColor::fromRgba(ref.rgba) : colors[static_cast<int>(ref.role)];
+        }
+
+        //* brush for given paint
+        QBrush brush(const ButtonPaint &paint, const QColor *colors)
+        {
+            switch (paint.type)
+            {
+                case ButtonPaint::Solid: return resolve(paint.color, colors);
+
+                case ButtonPaint::Gradient:
+                {
+                    const ButtonGradient &source(*paint.gradient);
+                    QGradientStops stops;
+                    stops.reserve(source.stops.size());
+                    for (const ButtonGradient::Stop &stop : source.stops)
+                    { stops.append(QGradientStop(stop.position, resolve(stop.color, colors))); }
+
+                    if (source.type == ButtonGradient::Linear)
+                    {
+                        QLinearGradient gradient(source.start, source.end);
+                        gradient.setStops(stops);
+                        return gradient;
+                    }
+
+                    QRadialGradient gradient(source.start, source.radius, source.end);
+                    gradient.setStops(stops);
+                    return gradient;
+                }
+
+                default: return Qt::NoBrush;
+            }
+        }
+
+    }
+
+    //__________________________________________________________________
+    ButtonStyle::ButtonStyle(int style, DecorationButtonType type):
+        m_style(style),
+        m_type(type)
+    {
+        const ButtonPalette::Slot slot = ButtonPalette::slot(type);
+        switch (style)
+        {
+            case MacSymbols:
+            m_colors = &ButtonPalette::MacSymbols[slot];
+            compileMacSymbols(type, m_layers);
+            break;
+
+            case Aqua:
+            m_colors = &ButtonPalette::Aqua[slot];
+            compileAqua(type, m_layers);
+            break;
+
+            case Sunken:
+            m_colors = &ButtonPalette::Sunken[slot];
+            compileSunken(type, m_layers);
+            break;
+
+            case Plasma:
+            compilePlasma(type, m_layers);
+            break;
+
+            case Oxygen:
+            m_glow = ButtonPalette::OxygenGlow[slot];
+            compileOxygen(type, m_layers);
+            break;
+
+            default: break;
+        }
+
+        if (m_colors) m_active = shades(m_colors->base);
+    }
+
+    //__________________________________________________________________
+    ButtonStyle::Shades ButtonStyle::shades(QRgb base)
+    {
+        Shades out;
+        out.base = QColor(base);
+        out.light = out.base.lighter(110);
+        out.dark = out.base.darker(110);
+        out.outline = out.base.darker(140);
+        return out;
+    }
+
+    //__________________________________________________________________
+    void ButtonStyle::setTitleBarColor(const QColor &color)
+    {
+        m_titleBarColor = color;
+
+        const int titleBarGray = qGray(color.rgb());
+
+        // buttons of inactive windows are gray. Its shades are derived here rather than on paint
+        int gray = titleBarGray;
+        if (gray <= 200) gray = qMax(gray + 55, 115);
+        else gray -= 45;
+        m_inactive = shades(qRgb(gray, gray, gray));
+
+        // Oxygen picks its bevel and symbol colors from the title bar lightness
+        m_lightTitleBar = titleBarGray > 130;
+        const ButtonPalette::OxygenColors &oxygen(ButtonPalette::Oxygen[m_lightTitleBar ? 1 : 0]);
+        m_oxygen.light = QColor(oxygen.light);
+        m_oxygen.dark = QColor(oxygen.dark).darker(130);
+        m_oxygen.rimTop = m_oxygen.light.lighter(110);
+        m_oxygen.rimBottom = m_oxygen.light.darker(110);
+    }
+
+    //__________________________________________________________________
+    void ButtonStyle::resolveColors(const ButtonRenderState &state, QColor *colors) const
+    {
+        auto set = [colors](ButtonColor role, const QColor &color) { colors[static_cast<int>(role)] = color; };
+
+        set(ButtonColor::Background, state.background);
+        set(ButtonColor::Foreground, state.foreground);
+        set(ButtonColor::BackgroundOrTitleBar, state.background.isValid() ? state.background : m_titleBarColor);
+
+        if (m_colors)
+        {
+            // buttons of inactive windows are gray, unless interacted with
+            const bool inactive = !(state.flags & (ButtonRenderState::Active|ButtonRenderState::Hovered|ButtonRenderState::Pressed|ButtonRenderState::Animating));
+            const Shades &shades(inactive ? m_inactive : m_active);
+            set(ButtonColor::Base, shades.base);
+            set(ButtonColor::BaseLight, shades.light);
+            set(ButtonColor::BaseDark, shades.dark);
+            set(ButtonColor::BaseOutline, shades.outline);
+            if (inactive)
+            {
+                set(ButtonColor::GradientTop, m_inactive.base);
+                set(ButtonColor::GradientBottom, m_inactive.base);
+            } else {
+                const bool checked = (state.flags & ButtonRenderState::Checked) && m_colors->checkedTop;
+                set(ButtonColor::GradientTop, QColor(checked ? m_colors->checkedTop : m_colors->top));
+                set(ButtonColor::GradientBottom, QColor(checked ? m_colors->checkedBottom : m_colors->bottom));
+            }
+
+            set(ButtonColor::Symbol, QColor(ButtonPalette::Symbol));
+        }
+
+        if (m_style == Oxygen)
+        {
+            const ButtonPalette::OxygenColors &oxygen(ButtonPalette::Oxygen[m_lightTitleBar ? 1 : 0]);
+            set(ButtonColor::Light, m_oxygen.light);
+            set(ButtonColor::RimTop, m_oxygen.rimTop);
+            set(ButtonColor::RimBottom, m_oxygen.rimBottom);
+            set(ButtonColor::Dark, m_oxygen.dark);
+            set(ButtonColor::Symbol, QColor(oxygen.symbol));
+            set(ButtonColor::SymbolShadow, QColor(oxygen.symbolShadow));
+            set(ButtonColor::Glow, QColor(m_glow));
+        }
+    }
+
+    //__________________________________________________________________
+    ButtonRenderState ButtonStyle::renderState(const ButtonTitleBarColors &palette, int flags, qreal progress) const
+    {
+        ButtonRenderState state;
+        state.flags = flags;
+        state.progress = progress;
+        state.background = backgroundColor(palette, flags, progress);
+        state.foreground = foregroundColor(palette, flags, progress);
+        if (state.background.isValid()) state.flags |= ButtonRenderState::HasBackground;
+        if (state.foreground.isValid()) state.flags |= ButtonRenderState::HasForeground;
+        return state;
+    }
+
+    //__________________________________________________________________
+    QColor ButtonStyle::foregroundColor(const ButtonTitleBarColors &palette, int flags, qreal progress) const
+    {
+        // only the Plasma style paints with the foreground color
+        if (m_style != Plasma) return palette.font;
+        else if (flags & ButtonRenderState::Pressed) return palette.titleBar;
+        else if (isKeep(m_type) && (flags & ButtonRenderState::Checked)) return palette.titleBar;
+        else if (flags & ButtonRenderState::Animating) return KColorUtils::mix(palette.font, palette.titleBar, progress);
+        else if (flags & ButtonRenderState::Hovered) return palette.titleBar;
+        else return palette.font;
+    }
+
+    //__________________________________________________________________
+    QColor ButtonStyle::backgroundColor(const ButtonTitleBarColors &palette, int flags, qreal progress) const
+    {
+        const int light = palette.lightTitleBar ? 1 : 0;
+        const bool pressed = flags & ButtonRenderState::Pressed;
+        const bool checked = flags & ButtonRenderState::Checked;
+        const bool animating = flags & ButtonRenderState::Animating;
+        const bool hovered = flags & ButtonRenderState::Hovered;
+
+        if (m_style != Plasma) {
+
+            if (!(pressed || animating || hovered)) return QColor();
+
+            ButtonPalette::BackgroundSlot slot;
+            switch (m_type)
+            {
+                case DecorationButtonType::Close: slot = ButtonPalette::CloseBackground; break;
+                case DecorationButtonType::Maximize: slot = checked ? ButtonPalette::RestoreBackground : ButtonPalette::MaximizeBackground; break;
+                case DecorationButtonType::Minimize: slot = ButtonPalette::MinimizeBackground; break;
+                case DecorationButtonType::ApplicationMenu: slot = ButtonPalette::ApplicationMenuBackground; break;
+                default: slot = ButtonPalette::OtherBackground; break;
+            }
+
+            return QColor(pressed ? ButtonPalette::PressedBackground[slot][light] : ButtonPalette::HoveredBackground[slot][light]);
+
+        }
+
+        const bool close = m_type == DecorationButtonType::Close;
+        if (pressed) {
+
+            if (close) return palette.warning;
+            else return QColor::fromRgba(ButtonPalette::PlasmaPressedBackground[light]);
+
+        } else if (isKeep(m_type) && checked) {
+
+            return QColor::fromRgba(ButtonPalette::PlasmaHoveredBackground[light]);
+
+        } else if (animating || hovered) {
+
+            QColor color(close ? palette.hoveredWarning : QColor::fromRgba(ButtonPalette::PlasmaHoveredBackground[light]));
+            if (animating) color.setAlpha(color.alpha()*progress);
+            return color;
+
+        }
+
+        return QColor();
+    }
+
+    //__________________________________________________________________
+    void ButtonStyle::render(QPainter *painter, const ButtonRenderState &state) const
+    {
+        if (m_layers.isEmpty()) return;
+
+        QColor colors[static_cast<int>(ButtonColor::Count)];
+        resolveColors(state, colors);
+
+        painter->setRenderHints(QPainter::Antialiasing);
+        for (const ButtonLayer &layer : m_layers)
+        {
+
+            if (!layer.matches(state.flags)) continue;
+
+            const QBrush fill = brush(layer.brush, colors);
+            QPen pen(Qt::NoPen);
+            if (layer.pen.type != ButtonPaint::None)
+            {
+                pen = QPen(brush(layer.pen, colors), qMax(layer.penScale/state.width, layer.penMinimum));
+                if (layer.roundCap)
+                {
+                    pen.setCapStyle(Qt::RoundCap);
+                    pen.setJoinStyle(Qt::MiterJoin);
+                }
+            }
+
+            // glyph paths are shared by all buttons, and only filled and stroked here
+            if (layer.shape == ButtonLayer::Glyph)
+            {
+                for (const ButtonSymbol::Part &part : ButtonSymbols::self()->symbol(layer.glyph).parts)
+                {
+                    if (part.filled && layer.brush.type != ButtonPaint::None) painter->fillPath(part.path, fill);
+                    if (pen.style() != Qt::NoPen) painter->strokePath(part.path, pen);
+                }
+                continue;
+            }
+
+            painter->setBrush(fill);
+            painter->setPen(pen);
+
+            switch (layer.shape)
+            {
+                case ButtonLayer::Ellipse:
+                painter->drawEllipse(layer.rect);
+                break;
+
+                case ButtonLayer::Disk:
+                {
+                    const qreal radius = layer.radius + layer.growth*state.progress;
+                    painter->drawEllipse(QPointF(9, 9), radius, radius);
+                    break;
+                }
+
+                case ButtonLayer::Glow:
+                case ButtonLayer::DropShadow:
+                {
+                    // glow and shadow discs are rasterized once, in the tile sets
+                    const QColor color = resolve(layer.brush.color, colors);
+                    const int size = qRound(layer.rect.width());
+                    if (layer.shape == ButtonLayer::Glow) ButtonTileSets::self()->drawGlow(painter, color, size);
+                    else ButtonTileSets::self()->drawShadow(painter, color, size);
+                    break;
+                }
+
+                default: break;
+            }
+
+        }
+    }
+
+}
@@ -0,0 +1,328 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "breezebuttonpalette.h"
+#include "breezebuttonsymbols.h"
+
+#include <KDecoration3/DecorationButton>
+
+#include <QColor>
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+
+class QPainter;
+
+namespace Breeze
+{
+
+    //* everything a button style needs to know to render one button
+    struct ButtonRenderState
+    {
+
+        //* state flags
+        enum Flag
+        {
+            Hovered = 1<<0,
+            Pressed = 1<<1,
+            Checked = 1<<2,
+            Active = 1<<3,
+            Maximized = 1<<4,
+            Animating = 1<<5,
+
+            //* Button::backgroundColor is valid
+            HasBackground = 1<<6,
+
+            //* Button::foregroundColor is valid
+            HasForeground = 1<<7
+        };
+
+        int flags = 0;
+
+        //* hover animation value, in [0, 1]
+        qreal progress = 0;
+
+        //* button width, in logical pixels. Pen widths depend on it
+        qreal width = 20;
+
+        //*@name colors
+        //@{
+        QColor background;
+        QColor foreground;
+        //@}
+
+    };
+
+    //* title bar colors from which button colors are derived
+    struct ButtonTitleBarColors
+    {
+        QColor titleBar;
+        QColor font;
+        QColor warning;
+        QColor hoveredWarning;
+
+        //* qGray(titleBar) > 100
+        bool lightTitleBar = false;
+    };
+
+    //* colors a layer can refer to, resolved once per render
+    enum class ButtonColor
+    {
+        None,
+        Literal,
+
+        //* per type base color, or gray for inactive windows, and its shades
+        Base,
+        BaseLight,
+        BaseDark,
+        BaseOutline,
+
+        //* per type gradient colors, or gray for inactive windows
+        GradientTop,
+        GradientBottom,
+
+        //* Button::backgroundColor and Button::foregroundColor
+        Background,
+        Foreground,
+
+        //* background, or title bar color if not valid
+        BackgroundOrTitleBar,
+
+        //* symbol and symbol shadow
+        Symbol,
+        SymbolShadow,
+
+        //* Oxygen bevel, rim and glow
+        Light,
+        Dark,
+        RimTop,
+        RimBottom,
+        Glow,
+
+        Count
+    };
+
+    //* reference to a resolved color
+    struct ButtonColorRef
+    {
+        ButtonColor role = ButtonColor::None;
+
+        //* for ButtonColor::Literal
+        QRgb rgba = 0;
+    };
+
+    //* gradient, in button design space
+    struct ButtonGradient
+    {
+        enum Type { Linear, Radial };
+        Type type = Linear;
+
+        //* start point (linear) or center (radial)
+        QPointF start;
+
+        //* end point (linear) or focal point (radial)
+        QPointF end;
+
+        //* radius (radial)
+        qreal radius = 0;
+
+        struct Stop
+        {
+            qreal position;
+            ButtonColorRef color;
+        };
+
+        QVector<Stop> stops;
+    };
+
+    //* brush or pen paint
+    struct ButtonPaint
+    {
+        enum Type { None, Solid, Gradient };
+        Type type = None;
+
+        //* for solid paint
+        ButtonColorRef color;
+
+        //* for gradient paint, owned by the style tables
+        const ButtonGradient *gradient = nullptr;
+    };
+
+    //* one drawing operation of a button style
+    struct ButtonLayer
+    {
+
+        enum Shape
+        {
+            //* ellipse inscribed in rect
+            Ellipse,
+
+            //* disk centered on the button, radius + growth*progress
+            Disk,
+
+            //* symbol
+            Glyph,
+
+            //* Oxygen outer glow, in brush color
+            Glow,
+
+            //* Oxygen drop shadow
+            DropShadow
+        };
+
+        Shape shape = Ellipse;
+
+        //*@name conditions, see ButtonRenderState::Flag
+        //@{
+
+        //* all of these must be set
+        int when = 0;
+
+        //* none of these may be set
+        int unless = 0;
+
+        //* at least one of these must be set, if any
+        int any = 0;
+
+        //@}
+
+        QRectF rect;
+        qreal radius = 0;
+        qreal growth = 0;
+        ButtonGlyph glyph = ButtonGlyph::None;
+
+        ButtonPaint brush;
+        ButtonPaint pen;
+
+        //* pen width is max(penScale/button width, penMinimum)
+        qreal penScale = 0;
+        qreal penMinimum = 1;
+
+        //* round caps and miter joins rather than QPen defaults
+        bool roundCap = false;
+
+        //* true if the layer is drawn in given state
+        bool matches(int flags) const
+        { return (flags & when) == when && !(flags & unless) && (!any || (flags & any)); }
+
+    };
+
+    //* data driven button renderer
+    /**
+    each style is described by a table of layers per button type. The table of the configured
+    style and button type is flattened into a display list once, on reconfiguration,
+    and executed on every paint by a small interpreter.
+    */
+    class ButtonStyle
+    {
+
+        public:
+
+        //* button styles, in the order of the configuration combo box
+        enum Style
+        {
+            MacSymbols,
+            Aqua,
+            Sunken,
+            Plasma,
+            Oxygen
+        };
+
+        //* constructor
+        explicit ButtonStyle(int style = MacSymbols, KDecoration3::DecorationButtonType type = KDecoration3::DecorationButtonType::Custom);
+
+        //* style
+        int style() const
+        { return m_style; }
+
+        //* button type
+        KDecoration3::DecorationButtonType type() const
+        { return m_type; }
+
+        //* display list
+        const QVector<ButtonLayer> &layers() const
+        { return m_layers; }
+
+        //* title bar color, from which inactive and symbol colors are derived
+        void setTitleBarColor(const QColor &color);
+
+        //*@name button colors, for given title bar colors, ButtonRenderState flags and hover animation value
+        //@{
+        QColor foregroundColor(const ButtonTitleBarColors &palette, int flags, qreal progress) const;
+        QColor backgroundColor(const ButtonTitleBarColors &palette, int flags, qreal progress) const;
+        //@}
+
+        //* full render state, with the colors above, for given ButtonRenderState flags and hover animation value
+        ButtonRenderState renderState(const ButtonTitleBarColors &palette, int flags, qreal progress) const;
+
+        //* render, in design space QRect(0, 0, 18, 18)
+        void render(QPainter *painter, const ButtonRenderState &state) const;
+
+        private:
+
+        //* resolve all colors of the display list for given state
+        void resolveColors(const ButtonRenderState &state, QColor *colors) const;
+
+        int m_style = MacSymbols;
+        KDecoration3::DecorationButtonType m_type = KDecoration3::DecorationButtonType::Custom;
+        QVector<ButtonLayer> m_layers;
+
+        //* a base color and its shades
+        struct Shades
+        {
+            QColor base;
+            QColor light;
+            QColor dark;
+            QColor outline;
+        };
+
+        //* base color and shades for given QRgb
+        static Shades shades(QRgb base);
+
+        //* per type colors, for MacSymbols, Aqua and Sunken
+        const ButtonPalette::SlotColors *m_colors = nullptr;
+        Shades m_active;
+
+        //* Oxygen glow
+        QRgb m_glow = 0;
+
+        //*@name colors derived from the title bar color
+        //@{
+        QColor m_titleBarColor;
+        Shades m_inactive;
+
+        //* Oxygen bevel and rim
+        struct
+        {
+            QColor light;
+            QColor dark;
+            QColor rimTop;
+            QColor rimBottom;
+        } m_oxygen;
+
+        bool m_lightTitleBar = false;
+        //@}
+
+    };
+
+}
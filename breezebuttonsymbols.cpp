@@ -0,0 +1,221 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezebuttonsymbols.h"
+
+#include <QPainterPath>
+
+#include <array>
+
+namespace Breeze
+{
+
+    namespace
+    {
+
+        //*@name glyph geometry, in button design space
+        //@{
+        struct GlyphPart
+        {
+            enum Type { Line, Polyline, Polygon, Ellipse, Rect, Point, HelpCurve };
+            Type type;
+
+            //* Ellipse and Rect are given by their top left corner and size
+            QVector<QPointF> points;
+        };
+
+        using Glyph = QVector<GlyphPart>;
+        using GlyphTable = std::array<Glyph, static_cast<int>(ButtonGlyph::Count)>;
+
+        GlyphPart line(qreal x1, qreal y1, qreal x2, qreal y2)
+        { return { GlyphPart::Line, { QPointF(x1, y1), QPointF(x2, y2) } }; }
+
+        GlyphPart polyline(const QVector<QPointF> &points)
+        { return { GlyphPart::Polyline, points }; }
+
+        GlyphPart polygon(const QVector<QPointF> &points)
+        { return { GlyphPart::Polygon, points }; }
+
+        GlyphPart ellipse(qreal x, qreal y, qreal w, qreal h)
+        { return { GlyphPart::Ellipse, { QPointF(x, y), QPointF(w, h) } }; }
+
+        GlyphPart rect(qreal x, qreal y, qreal w, qreal h)
+        { return { GlyphPart::Rect, { QPointF(x, y), QPointF(w, h) } }; }
+
+        GlyphPart point(qreal x, qreal y)
+        { return { GlyphPart::Point, { QPointF(x, y) } }; }
+
+        GlyphPart helpCurve()
+        { return { GlyphPart::HelpCurve, {} }; }
+
+        //* question mark curve of the context help button
+        QPainterPath helpCurvePath()
+        {
+            QPainterPath path;
+            path.moveTo(5, 6);
+            path.arcTo(QRectF(5, 3.5, 8, 5), 180, -180);
+            path.cubicTo(QPointF(12.5, 9.5), QPointF(9, 7.5), QPointF(9, 11.5));
+            return path;
+        }
+
+        const GlyphTable &glyphTable()
+        {
+            static const GlyphTable table = []
+            {
+                using G = ButtonGlyph;
+                using P = QPointF;
+                GlyphTable t;
+                auto set = [&t](ButtonGlyph glyph, const Glyph &parts) { t[static_cast<int>(glyph)] = parts; };
+
+                // MacSymbols, Aqua and Sunken
+                set(G::MacClose, { line(6, 6, 12, 12), line(6, 12, 12, 6) });
+                set(G::MacMaximize, { polygon({ P(5, 13), P(11, 13), P(5, 7) }), polygon({ P(13, 5), P(7, 5), P(13, 11) }) });
+                set(G::MacRestore, { polygon({ P(8.5, 9.5), P(2.5, 9.5), P(8.5, 15.5) }), polygon({ P(9.5, 8.5), P(15.5, 8.5), P(9.5, 2.5) }) });
+                set(G::MacMinimize, { line(5, 9, 13, 9) });
+                set(G::MacOnAllDesktops, { ellipse(6, 6, 6, 6) });
+                set(G::MacShade, { line(5, 6, 13, 6), polyline({ P(5, 13), P(9, 9), P(13, 13) }) });
+                set(G::MacUnshade, { line(5, 6, 13, 6), polyline({ P(5, 9), P(9, 13), P(13, 9) }) });
+                set(G::AquaShade, { polyline({ P(5, 13), P(9, 9), P(13, 13) }) });
+                set(G::MacKeepBelow, { polyline({ P(6, 6), P(9, 9), P(12, 6) }), polyline({ P(6, 10), P(9, 13), P(12, 10) }) });
+                set(G::MacKeepAbove, { polyline({ P(6, 8), P(9, 5), P(12, 8) }), polyline({ P(6, 12), P(9, 9), P(12, 12) }) });
+                set(G::MacApplicationMenu, { line(4.5, 6, 13.5, 6), line(4.5, 9, 13.5, 9), line(4.5, 12, 13.5, 12) });
+                set(G::MacContextHelp, { helpCurve(), point(9, 15) });
+
+                // Plasma
+                set(G::PlasmaClose, { line(5, 5, 13, 13), line(13, 5, 5, 13) });
+                set(G::PlasmaMaximize, { polyline({ P(5, 8), P(5, 13), P(10, 13) }), polyline({ P(8, 5), P(13, 5), P(13, 10) }) });
+                set(G::PlasmaMinimize, { line(4, 9, 14, 9) });
+                set(G::PlasmaPinHead, { polygon({ P(6.5, 8.5), P(12, 3), P(15, 6), P(9.5, 11.5) }) });
+                set(G::PlasmaPinNeedle, { line(5.5, 7.5, 10.5, 12.5), line(12, 6, 4.5, 13.5) });
+                set(G::PlasmaPinnedRing, { ellipse(3, 3, 12, 12) });
+                set(G::PlasmaPinnedDot, { ellipse(8, 8, 2, 2) });
+                set(G::PlasmaShade, { line(4, 5.5, 14, 5.5), polyline({ P(4, 13), P(9, 8), P(14, 13) }) });
+                set(G::PlasmaUnshade, { line(4, 5.5, 14, 5.5), polyline({ P(4, 8), P(9, 13), P(14, 8) }) });
+                set(G::PlasmaKeepBelow, { polyline({ P(4, 5), P(9, 10), P(14, 5) }), polyline({ P(4, 9), P(9, 14), P(14, 9) }) });
+                set(G::PlasmaKeepAbove, { polyline({ P(4, 9), P(9, 4), P(14, 9) }), polyline({ P(4, 13), P(9, 8), P(14, 13) }) });
+                set(G::PlasmaApplicationMenu, { rect(3.5, 4.5, 11, 1), rect(3.5, 8.5, 11, 1), rect(3.5, 12.5, 11, 1) });
+                set(G::PlasmaContextHelp, { helpCurve(), rect(9, 15, 0.5, 0.5) });
+
+                // Oxygen
+                set(G::OxygenClose, { line(7.5, 7.5, 13.5, 13.5), line(13.5, 7.5, 7.5, 13.5) });
+                set(G::OxygenCloseShadow, { line(8.5, 8.5, 14.5, 14.5), line(14.5, 8.5, 8.5, 14.5) });
+                set(G::OxygenMaximize, { polyline({ P(7.5, 11.5), P(10.5, 8.5), P(13.5, 11.5) }) });
+                set(G::OxygenMaximizeShadow, { polyline({ P(8.5, 12.5), P(11.5, 9.5), P(14.5, 12.5) }) });
+                set(G::OxygenRestore, { polygon({ P(7.5, 10.5), P(10.5, 7.5), P(13.5, 10.5), P(10.5, 13.5) }) });
+                set(G::OxygenRestoreShadow, { polygon({ P(8.5, 11.5), P(11.5, 8.5), P(14.5, 11.5), P(11.5, 14.5) }) });
+                set(G::OxygenMinimize, { polyline({ P(7.5, 9.5), P(10.5, 12.5), P(13.5, 9.5) }) });
+                set(G::OxygenMinimizeShadow, { polyline({ P(8.5, 10.5), P(11.5, 13.5), P(14.5, 10.5) }) });
+                set(G::OxygenOnAllDesktops, { point(10.5, 10.5) });
+                set(G::OxygenOnAllDesktopsShadow, { point(11.5, 11.5) });
+                set(G::OxygenKeepBelow, { polyline({ P(7.5, 11), P(10.5, 14), P(13.5, 11) }), polyline({ P(7.5, 7), P(10.5, 10), P(13.5, 7) }) });
+                set(G::OxygenKeepBelowShadow, { polyline({ P(8.5, 12), P(11.5, 15), P(14.5, 12) }), polyline({ P(8.5, 8), P(11.5, 11), P(14.5, 8) }) });
+                set(G::OxygenKeepAbove, { polyline({ P(7.5, 14), P(10.5, 11), P(13.5, 14) }), polyline({ P(7.5, 10), P(10.5, 7), P(13.5, 10) }) });
+                set(G::OxygenKeepAboveShadow, { polyline({ P(8.5, 15), P(11.5, 11), P(14.5, 15) }), polyline({ P(8.5, 11), P(11.5, 7), P(14.5, 11) }) });
+                set(G::OxygenApplicationMenu, { line(7.5, 8, 13.5, 8), line(7.5, 11, 13.5, 11), line(7.5, 14, 13.5, 14) });
+                set(G::OxygenApplicationMenuShadow, { line(8.5, 8, 14.5, 8), line(8.5, 11, 14.5, 11), line(8.5, 14, 14.5, 14) });
+
+                return t;
+            }();
+
+            return table;
+        }
+        //@}
+
+    }
+
+    ButtonSymbols *ButtonSymbols::s_self = nullptr;
+
+    //__________________________________________________________________
+    ButtonSymbols::ButtonSymbols()
+    {
+        m_symbols.reserve(static_cast<int>(ButtonGlyph::Count));
+        for (int glyph = 0; glyph < static_cast<int>(ButtonGlyph::Count); ++glyph)
+        { m_symbols.append(createSymbol(static_cast<ButtonGlyph>(glyph))); }
+    }
+
+    //__________________________________________________________________
+    ButtonSymbols::~ButtonSymbols()
+    { s_self = nullptr; }
+
+    //__________________________________________________________________
+    ButtonSymbols *ButtonSymbols::self()
+    {
+        if (!s_self)
+        { s_self = new ButtonSymbols(); }
+
+        return s_self;
+    }
+
+    //__________________________________________________________________
+    ButtonSymbol ButtonSymbols::createSymbol(ButtonGlyph glyph)
+    {
+        // closed parts are both filled and stroked, open parts are only stroked
+        ButtonSymbol symbol;
+        for (const GlyphPart &part : glyphTable()[static_cast<int>(glyph)])
+        {
+            const QVector<QPointF> &p(part.points);
+            ButtonSymbol::Part out;
+            switch (part.type)
+            {
+                case GlyphPart::Line:
+                out.path.moveTo(p[0]);
+                out.path.lineTo(p[1]);
+                break;
+
+                case GlyphPart::Polyline:
+                out.path.addPolygon(QPolygonF(p));
+                break;
+
+                case GlyphPart::Polygon:
+                out.path.addPolygon(QPolygonF(p));
+                out.path.closeSubpath();
+                out.filled = true;
+                break;
+
+                case GlyphPart::Ellipse:
+                out.path.addEllipse(QRectF(p[0], QSizeF(p[1].x(), p[1].y())));
+                out.filled = true;
+                break;
+
+                case GlyphPart::Rect:
+                out.path.addRect(QRectF(p[0], QSizeF(p[1].x(), p[1].y())));
+                out.filled = true;
+                break;
+
+                case GlyphPart::Point:
+                // as QPainter::drawPoint, which strokes a line of length 1/63
+                out.path.moveTo(p[0]);
+                out.path.lineTo(p[0] + QPointF(1/63., 0));
+                break;
+
+                case GlyphPart::HelpCurve:
+                out.path = helpCurvePath();
+                out.filled = true;
+                break;
+            }
+
+            symbol.parts.append(out);
+        }
+
+        return symbol;
+    }
+
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QPainterPath>
+#include <QVector>
+
+namespace Breeze
+{
+
+    //* symbols drawn on top of button backgrounds
+    enum class ButtonGlyph
+    {
+        None,
+
+        //*@name shared by MacSymbols, Aqua and Sunken
+        //@{
+        MacClose,
+        MacMaximize,
+        MacRestore,
+        MacMinimize,
+        MacOnAllDesktops,
+        MacShade,
+        MacUnshade,
+        AquaShade,
+        MacKeepBelow,
+        MacKeepAbove,
+        MacApplicationMenu,
+        MacContextHelp,
+        //@}
+
+        //*@name Plasma
+        //@{
+        PlasmaClose,
+        PlasmaMaximize,
+        PlasmaMinimize,
+        PlasmaPinHead,
+        PlasmaPinNeedle,
+        PlasmaPinnedRing,
+        PlasmaPinnedDot,
+        PlasmaShade,
+        PlasmaUnshade,
+        PlasmaKeepBelow,
+        PlasmaKeepAbove,
+        PlasmaApplicationMenu,
+        PlasmaContextHelp,
+        //@}
+
+        //*@name Oxygen, each with its shadow offset by one pixel
+        //@{
+        OxygenClose,
+        OxygenCloseShadow,
+        OxygenMaximize,
+        OxygenMaximizeShadow,
+        OxygenRestore,
+        OxygenRestoreShadow,
+        OxygenMinimize,
+        OxygenMinimizeShadow,
+        OxygenOnAllDesktops,
+        OxygenOnAllDesktopsShadow,
+        OxygenKeepBelow,
+        OxygenKeepBelowShadow,
+        OxygenKeepAbove,
+        OxygenKeepAboveShadow,
+        OxygenApplicationMenu,
+        OxygenApplicationMenuShadow,
+        //@}
+
+        Count
+    };
+
+    //* a glyph, ready to be painted
+    /**
+    parts are painted one after the other, as separate QPainter calls:
+    where they overlap, antialiased edges are blended once per part.
+    */
+    struct ButtonSymbol
+    {
+        struct Part
+        {
+            //* center line, stroked with the layer pen
+            QPainterPath path;
+
+            //* true if the path is also filled with the layer brush
+            bool filled = false;
+        };
+
+        QVector<Part> parts;
+    };
+
+    //* process-wide library of button glyphs
+    /**
+    glyphs are built once, in the 18x18 design space of the button styles.
+    They are stroked on paint rather than pre-stroked: QPainter rasterizes pen strokes in device space,
+    and filling a stroke computed in design space does not give the same pixels.
+    */
+    class ButtonSymbols
+    {
+
+        public:
+
+        //* destructor
+        ~ButtonSymbols();
+
+        //* singleton
+        static ButtonSymbols *self();
+
+        //* symbol for given glyph
+        const ButtonSymbol &symbol(ButtonGlyph glyph) const
+        { return m_symbols[static_cast<int>(glyph)]; }
+
+        private:
+
+        //* constructor
+        ButtonSymbols();
+
+        //* build a symbol
+        static ButtonSymbol createSymbol(ButtonGlyph glyph);
+
+        //* symbols, by glyph
+        QVector<ButtonSymbol> m_symbols;
+
+        //* singleton
+        static ButtonSymbols *s_self;
+
+    };
+
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezebuttontilesets.h"
+
+#include <QHashFunctions>
+#include <QPaintDevice>
+#include <QPainter>
+#include <QRadialGradient>
+#include <QTransform>
+#include <QtMath>
+
+#include <cmath>
+
+namespace Breeze
+{
+
+    //* upper bound for the memory used by tiles (bytes)
+    static constexpr int s_maxTileCost = 2*1024*1024;
+
+    ButtonTileSets *ButtonTileSets::s_self = nullptr;
+
+    namespace
+    {
+
+        //* color with alpha scaled by given factor
+        QColor alphaColor(QColor color, qreal alpha)
+        {
+            if (alpha >= 0 && alpha < 1.0) {
+                color.setAlphaF(alpha * color.alphaF());
+            }
+            return color;
+        }
+
+        //*@name generic outer glow, as a ring and the inside mask cut out of what is below it
+        //@{
+        void drawOuterGlow(QPainter *painter, const QColor &color, int size)
+        {
+            const QRectF r(0, 0, size, size);
+            const qreal m(qreal(size) * 0.5);
+            const qreal width(3);
+            const qreal glowBias = 0.6;
+
+            const qreal bias(glowBias * qreal(18) / size);
+
+            // k0 is located at width - bias from the outer edge
+            const qreal gm(m + bias - 0.9);
+            const qreal k0((m - width + bias) / gm);
+            QRadialGradient glowGradient(m, m, gm);
+            for (int i = 0; i < 8; i++) {
+                // k1 grows linearly from k0 to 1.0
+                const qreal k1(k0 + qreal(i) * (1.0 - k0) / 8.0);
+
+                // a folows sqrt curve
+                const qreal a(1.0 - sqrt(qreal(i) / 8));
+                glowGradient.setColorAt(k1, alphaColor(color, a));
+            }
+
+            // glow
+            painter->save();
+            painter->setBrush(glowGradient);
+            painter->setPen(Qt::NoPen);
+            painter->drawEllipse(r);
+            painter->restore();
+        }
+
+        void drawGlowMask(QPainter *painter, int size)
+        {
+            const QRectF r(0, 0, size, size);
+            const qreal width(3);
+
+            painter->save();
+            painter->setBrush(Qt::black);
+            painter->setPen(Qt::NoPen);
+            painter->drawEllipse(r.adjusted(width + 0.5, width + 0.5, -width - 1, -width - 1));
+            painter->restore();
+        }
+        //@}
+
+        //* generic outer shadow
+        void drawOuterShadow(QPainter *painter, const QColor &color, int size)
+        {
+            const qreal m(qreal(size - 2) * 0.5);
+            const qreal offset(0.6);
+            const qreal k0((m - 4.0) / m);
+            const qreal shadowGain = 1.5;
+
+            QRadialGradient shadowGradient(m + 1.0, m + offset + 1.0, m);
+            for (int i = 0; i < 8; i++) {
+                // sinusoidal gradient
+                const qreal k1((k0 * qreal(8 - i) + qreal(i)) * 0.125);
+                const qreal a((cos(M_PI * i * 0.125) + 1.0) * 0.30);
+                shadowGradient.setColorAt(k1, alphaColor(color, a * shadowGain));
+            }
+
+            shadowGradient.setColorAt(1.0, alphaColor(color, 0.0));
+            painter->save();
+            painter->setBrush(shadowGradient);
+            painter->setPen(Qt::NoPen);
+            painter->drawEllipse(QRectF(0, 0, size, size));
+            painter->restore();
+        }
+
+    }
+
+    //__________________________________________________________________
+    size_t qHash(const ButtonTileKey &key, size_t seed) noexcept
+    {
+        return qHashMulti(seed, int(key.kind), key.color, key.size, qRound(key.scale*64),
+            qRound(key.offset.x()*64), qRound(key.offset.y()*64));
+    }
+
+    //__________________________________________________________________
+    ButtonTileSets::ButtonTileSets():
+        m_tiles(s_maxTileCost)
+    {}
+
+    //__________________________________________________________________
+    ButtonTileSets::~ButtonTileSets()
+    { s_self = nullptr; }
+
+    //__________________________________________________________________
+    ButtonTileSets *ButtonTileSets::self()
+    {
+        if (!s_self)
+        { s_self = new ButtonTileSets(); }
+
+        return s_self;
+    }
+
+    //__________________________________________________________________
+    void ButtonTileSets::drawGlow(QPainter *painter, const QColor &color, int size)
+    {
+        draw(painter, ButtonTileKey::Glow, color, size);
+
+        // the inside of the glow is cleared, including any shadow painted before
+        painter->save();
+        painter->setCompositionMode(QPainter::CompositionMode_DestinationOut);
+        draw(painter, ButtonTileKey::GlowMask, Qt::black, size);
+        painter->restore();
+    }
+
+    //__________________________________________________________________
+    void ButtonTileSets::drawShadow(QPainter *painter, const QColor &color, int size)
+    { draw(painter, ButtonTileKey::Shadow, color, size); }
+
+    //__________________________________________________________________
+    void ButtonTileSets::draw(QPainter *painter, ButtonTileKey::Kind kind, const QColor &color, int size)
+    {
+        // buttons are only ever scaled and translated. Tiles are rendered at the device scale,
+        // with the same sub-pixel origin, and blitted at the integer part of the origin
+        const QTransform &transform(painter->worldTransform());
+        const qreal dpr = painter->device() ? painter->device()->devicePixelRatio() : 1;
+        const QPointF origin(transform.dx()*dpr, transform.dy()*dpr);
+        const QPointF pixel(std::floor(origin.x()), std::floor(origin.y()));
+
+        ButtonTileKey key;
+        key.kind = kind;
+        key.color = kind == ButtonTileKey::GlowMask ? 0 : color.rgba();
+        key.size = size;
+        key.scale = std::hypot(transform.m11(), transform.m12())*dpr;
+        key.offset = origin - pixel;
+
+        const QImage image(tile(key));
+        if (image.isNull()) return;
+
+        painter->save();
+        painter->setWorldTransform(QTransform::fromScale(1/dpr, 1/dpr));
+        painter->drawImage(pixel, image);
+        painter->restore();
+    }
+
+    //__________________________________________________________________
+    QImage ButtonTileSets::tile(const ButtonTileKey &key)
+    {
+        if (const QImage *image = m_tiles.object(key))
+            return *image;
+
+        const QImage image(createTile(key));
+        if (!image.isNull())
+            m_tiles.insert(key, new QImage(image), qMax<qsizetype>(1, image.sizeInBytes()));
+        return image;
+    }
+
+    //__________________________________________________________________
+    QImage ButtonTileSets::createTile(const ButtonTileKey &key)
+    {
+        if (key.size <= 0) return QImage();
+
+        const int pixels = qCeil(key.size*key.scale + qMax(key.offset.x(), key.offset.y()));
+        QImage image(pixels, pixels, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::transparent);
+
+        QPainter painter(&image);
+        painter.setRenderHints(QPainter::Antialiasing);
+        painter.translate(key.offset);
+        painter.scale(key.scale, key.scale);
+
+        switch (key.kind)
+        {
+            case ButtonTileKey::Glow: drawOuterGlow(&painter, QColor::fromRgba(key.color), key.size); break;
+            case ButtonTileKey::GlowMask: drawGlowMask(&painter, key.size); break;
+            case ButtonTileKey::Shadow: drawOuterShadow(&painter, QColor::fromRgba(key.color), key.size); break;
+        }
+
+        return image;
+    }
+
+}
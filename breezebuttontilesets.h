@@ -0,0 +1,110 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QColor>
+#include <QImage>
+#include <QPointF>
+
+class QPainter;
+
+namespace Breeze
+{
+
+    //* everything an Oxygen glow or shadow tile depends on
+    struct ButtonTileKey
+    {
+
+        //* the glow is a ring, and a mask that is cut out of what is below
+        enum Kind { Glow, GlowMask, Shadow };
+        Kind kind = Glow;
+
+        QRgb color = 0;
+
+        //* size, in button design space
+        int size = 0;
+
+        //* device pixels per design space unit
+        qreal scale = 1;
+
+        //* position of the design space origin within its device pixel, in [0, 1)
+        QPointF offset;
+
+        bool operator == (const ButtonTileKey &other) const
+        {
+            return kind == other.kind
+                && color == other.color
+                && size == other.size
+                && scale == other.scale
+                && offset == other.offset;
+        }
+
+    };
+
+    size_t qHash(const ButtonTileKey &key, size_t seed = 0) noexcept;
+
+    //* process-wide cache of the Oxygen glow and shadow discs, shared by all buttons
+    /**
+    the discs are radial gradients that only depend on their color, size and device transform.
+    They are rasterized once, aligned on the device pixel grid, and then blitted without scaling,
+    which gives the same pixels as painting the gradients.
+    */
+    class ButtonTileSets
+    {
+
+        public:
+
+        //* destructor
+        ~ButtonTileSets();
+
+        //* singleton
+        static ButtonTileSets *self();
+
+        //* paint outer glow of given color, covering QRect(0, 0, size, size)
+        void drawGlow(QPainter *painter, const QColor &color, int size);
+
+        //* paint drop shadow of given color, covering QRect(0, 0, size, size)
+        void drawShadow(QPainter *painter, const QColor &color, int size);
+
+        private:
+
+        //* constructor
+        ButtonTileSets();
+
+        //* blit tile of given kind at the painter origin
+        void draw(QPainter *painter, ButtonTileKey::Kind kind, const QColor &color, int size);
+
+        //* tile for given key, rendered on demand
+        QImage tile(const ButtonTileKey &key);
+
+        //* rasterize a tile
+        static QImage createTile(const ButtonTileKey &key);
+
+        //* tiles, cost is their size in bytes
+        QCache<ButtonTileKey, QImage> m_tiles;
+
+        //* singleton
+        static ButtonTileSets *s_self;
+
+    };
+
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezecaptionlayout.h"
+
+#include <QTextLayout>
+#include <QTextOption>
+
+namespace Breeze
+{
+
+    //* ellipsis, as used by QFontMetrics::elidedText
+    static const QChar s_ellipsis(0x2026);
+
+    //__________________________________________________________________
+    void CaptionLayout::setFont(const TitleBarFontPtr &font)
+    {
+        if (m_font == font) return;
+        m_font = font;
+        m_dirty = true;
+    }
+
+    //__________________________________________________________________
+    void CaptionLayout::setCaption(const QString &caption)
+    {
+        if (m_caption == caption) return;
+        m_caption = caption;
+        m_dirty = true;
+    }
+
+    //__________________________________________________________________
+    qreal CaptionLayout::width()
+    {
+        if (m_dirty) layout();
+        return m_width;
+    }
+
+    //__________________________________________________________________
+    const QStaticText &CaptionLayout::text(qreal availableWidth)
+    {
+        if (m_dirty) layout();
+        if (availableWidth == m_availableWidth) return m_text;
+
+        m_availableWidth = availableWidth;
+        m_text.setText(elide(availableWidth));
+        if (m_font) m_text.prepare(QTransform(), m_font->paintFont());
+        return m_text;
+    }
+
+    //__________________________________________________________________
+    void CaptionLayout::layout()
+    {
+        m_dirty = false;
+        m_availableWidth = -1;
+        m_boundaries.clear();
+        m_positions.clear();
+        m_width = 0;
+
+        m_text = QStaticText();
+        m_text.setTextFormat(Qt::PlainText);
+        m_text.setPerformanceHint(QStaticText::AggressiveCaching);
+
+        if (!m_font) return;
+
+        m_rightToLeft = m_caption.isRightToLeft();
+        m_ellipsisWidth = QFontMetricsF(m_font->paintFont()).horizontalAdvance(s_ellipsis);
+
+        // shape the caption once, on a single line
+        QTextOption option;
+        option.setWrapMode(QTextOption::NoWrap);
+
+        QTextLayout textLayout(m_caption, m_font->paintFont());
+        textLayout.setTextOption(option);
+        textLayout.beginLayout();
+        QTextLine line = textLayout.createLine();
+        textLayout.endLayout();
+        if (!line.isValid()) return;
+
+        m_width = line.naturalTextWidth();
+        if (m_rightToLeft) return;
+
+        // position of every grapheme boundary
+        m_boundaries.reserve(m_caption.size() + 1);
+        m_positions.reserve(m_caption.size() + 1);
+        for (int i = 0; i <= m_caption.size(); ++i)
+        {
+            if (i > 0 && i < m_caption.size() && !textLayout.isValidCursorPosition(i)) continue;
+            m_boundaries.append(i);
+            m_positions.append(line.cursorToX(i));
+        }
+    }
+
+    //__________________________________________________________________
+    QString CaptionLayout::elide(qreal availableWidth) const
+    {
+        if (m_width <= availableWidth) return m_caption;
+        if (!m_font) return QString();
+        if (m_rightToLeft) return QFontMetricsF(m_font->paintFont()).elidedText(m_caption, Qt::ElideMiddle, availableWidth);
+        if (m_ellipsisWidth > availableWidth) return QString();
+
+        // width when keeping given number of graphemes, the extra one on the left
+        const int count = m_boundaries.size() - 1;
+        auto width = [this, count](int kept)
+        {
+            const int left = (kept + 1)/2;
+            const int right = kept/2;
+            return m_positions[left] + m_ellipsisWidth + (m_width - m_positions[count - right]);
+        };
+
+        // the width grows with the number of kept graphemes, so that the largest fitting one is found by bisection
+        int low = 0;
+        int high = count - 1;
+        while (low < high)
+        {
+            const int middle = (low + high + 1)/2;
+            if (width(middle) <= availableWidth) low = middle;
+            else high = middle - 1;
+        }
+
+        const int left = (low + 1)/2;
+        const int right = low/2;
+        return m_caption.left(m_boundaries[left]) + s_ellipsis + m_caption.mid(m_boundaries[count - right]);
+    }
+
+}
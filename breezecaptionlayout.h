@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "breezetitlebarfont.h"
+
+#include <QStaticText>
+#include <QString>
+#include <QVector>
+
+namespace Breeze
+{
+
+    //* caption of one decoration, shaped once and elided on demand
+    /**
+    the caption is shaped once per caption and font change, which gives the position of every
+    grapheme boundary. Eliding to a new width is then a binary search over these positions,
+    and the elided text is kept as a prepared QStaticText until caption, font or width change.
+    */
+    class CaptionLayout
+    {
+
+        public:
+
+        //* font. Changes are detected on the shared font instance
+        void setFont(const TitleBarFontPtr &font);
+
+        //* caption
+        void setCaption(const QString &caption);
+
+        //* natural width of the full caption
+        qreal width();
+
+        //* caption elided in the middle to fit given width, ready to be drawn
+        const QStaticText &text(qreal availableWidth);
+
+        private:
+
+        //* shape the full caption
+        void layout();
+
+        //* caption elided in the middle to fit given width
+        QString elide(qreal availableWidth) const;
+
+        TitleBarFontPtr m_font;
+        QString m_caption;
+
+        //* true when caption or font changed since the last layout
+        bool m_dirty = true;
+
+        //*@name shaped caption
+        //@{
+
+        //* grapheme boundaries, as string positions, and their x position
+        QVector<int> m_boundaries;
+        QVector<qreal> m_positions;
+
+        qreal m_width = 0;
+        qreal m_ellipsisWidth = 0;
+
+        //* right to left captions are elided by QFontMetricsF, positions are not monotonic
+        bool m_rightToLeft = false;
+
+        //@}
+
+        //*@name elided caption
+        //@{
+        qreal m_availableWidth = -1;
+        QStaticText m_text;
+        //@}
+
+    };
+
+}
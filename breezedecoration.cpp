@@ -25,8 +25,11 @@
 #include "config/breezeconfigwidget.h"
 
 #include "breezebutton.h"
+#include "breezebuttoncache.h"
+#include "breezeframecache.h"
+#include "breezeshadowcache.h"
+#include "breezetitlebarcache.h"
 
-#include "breezeboxshadowrenderer.h"
 
 #include <KDecoration3/DecorationButtonGroup>
 #include <KDecoration3/DecorationShadow>
@@ -41,6 +44,8 @@
 #include <QDBusMessage>
 #include <QDBusPendingCallWatcher>
 #include <QDBusPendingReply>
+#include <QHash>
+#include <QLoggingCategory>
 #include <QPainter>
 #include <QPainterPath>
 #include <QTextStream>
@@ -52,84 +57,51 @@ K_PLUGIN_FACTORY_WITH_JSON(BreezeDecoFactory, "breezeenhanced.json", registerPlu
 
 namespace
 {
-    struct ShadowParams {
-        ShadowParams()
-            : offset(QPoint(0, 0))
-            , radius(0)
-            , opacity(0) {}
-
-        ShadowParams(const QPoint &offset, int radius, qreal opacity)
-            : offset(offset)
-            , radius(radius)
-            , opacity(opacity) {}
-
-        QPoint offset;
-        int radius;
-        qreal opacity;
-    };
-
-    struct CompositeShadowParams {
-        CompositeShadowParams() = default;
-
-        CompositeShadowParams(
-                const QPoint &offset,
-                const ShadowParams &shadow1,
-                const ShadowParams &shadow2)
-            : offset(offset)
-            , shadow1(shadow1)
-            , shadow2(shadow2) {}
-
-        bool isNone() const {
-            return qMax(shadow1.radius, shadow2.radius) == 0;
-        }
+    //* corner of the blur region, an ellipse or a square inscribed in given rect
+    QRegion blurCorner(const QRectF &rect, bool rounded)
+    {
+        const QRect r = rect.toRect();
+        if (!rounded) return QRegion(r);
+
+        // ellipse regions only depend on their size. They are built once and translated into place
+        static QHash<quint64, QRegion> s_ellipses;
+        const quint64 key = (quint64(quint32(r.width())) << 32) | quint32(r.height());
+        auto it = s_ellipses.constFind(key);
+        if (it == s_ellipses.constEnd())
+        { it = s_ellipses.insert(key, QRegion(QRect(QPoint(0, 0), r.size()), QRegion::Ellipse)); }
+
+        return it->translated(r.topLeft());
+    }
+
+    //* stretch a region by delta pixels, starting at given row or column
+    /**
+    the region must be uniform across the stretched band: to grow, the row or column at cut is repeated.
+    To shrink, the rows or columns following cut are removed
+    */
+    QRegion stretchRegion(const QRegion &region, Qt::Orientation orientation, int cut, int delta)
+    {
+        if (!delta || region.isEmpty()) return region;
+
+        const bool horizontal(orientation == Qt::Horizontal);
+        const QRect bounds(region.boundingRect());
 
-        QPoint offset;
-        ShadowParams shadow1;
-        ShadowParams shadow2;
-    };
-
-    const CompositeShadowParams s_shadowParams[] = {
-        // None
-        CompositeShadowParams(),
-        // Small
-        CompositeShadowParams(
-            QPoint(0, 4),
-            ShadowParams(QPoint(0, 0), 16, 1),
-            ShadowParams(QPoint(0, -2), 8, 0.4)),
-        // Medium
-        CompositeShadowParams(
-            QPoint(0, 8),
-            ShadowParams(QPoint(0, 0), 32, 0.9),
-            ShadowParams(QPoint(0, -4), 16, 0.3)),
-        // Large
-        CompositeShadowParams(
-            QPoint(0, 12),
-            ShadowParams(QPoint(0, 0), 48, 0.8),
-            ShadowParams(QPoint(0, -6), 24, 0.2)),
-        // Very large
-        CompositeShadowParams(
-            QPoint(0, 16),
-            ShadowParams(QPoint(0, 0), 64, 0.7),
-            ShadowParams(QPoint(0, -8), 32, 0.1)),
-    };
-
-    inline CompositeShadowParams lookupShadowParams(int size)
-    {
-        switch (size) {
-        case Breeze::InternalSettings::ShadowNone:
-            return s_shadowParams[0];
-        case Breeze::InternalSettings::ShadowSmall:
-            return s_shadowParams[1];
-        case Breeze::InternalSettings::ShadowMedium:
-            return s_shadowParams[2];
-        case Breeze::InternalSettings::ShadowLarge:
-            return s_shadowParams[3];
-        case Breeze::InternalSettings::ShadowVeryLarge:
-            return s_shadowParams[4];
-        default:
-            // Fallback to the Large size.
-            return s_shadowParams[3];
+        // part before cut is unchanged, part after the removed band is moved
+        const int from = cut + qMax(0, -delta);
+        const QRect head(horizontal ? QRect(bounds.topLeft(), QPoint(cut - 1, bounds.bottom())) : QRect(bounds.topLeft(), QPoint(bounds.right(), cut - 1)));
+        const QRect tail(horizontal ? QRect(QPoint(from, bounds.top()), bounds.bottomRight()) : QRect(QPoint(bounds.left(), from), bounds.bottomRight()));
+
+        QRegion stretched(region.intersected(head));
+        stretched += region.intersected(tail).translated(horizontal ? QPoint(delta, 0) : QPoint(0, delta));
+
+        // repeat the line at cut over the added band
+        if (delta > 0)
+        {
+            const QRegion line(region.intersected(horizontal ? QRect(cut, bounds.top(), 1, bounds.height()) : QRect(bounds.left(), cut, bounds.width(), 1)));
+            for (const QRect &rect : line)
+            { stretched += horizontal ? QRect(cut, rect.top(), delta, rect.height()) : QRect(rect.left(), cut, rect.width(), delta); }
         }
+
+        return stretched;
     }
 }
 
@@ -140,30 +112,27 @@ namespace Breeze
     using KDecoration3::ColorGroup;
 
     //________________________________________________________________
-    static int g_sDecoCount = 0;
-    static int g_shadowSizeEnum = InternalSettings::ShadowLarge;
-    static int g_shadowStrength = 255;
-    static QColor g_shadowColor = Qt::black;
-    static std::shared_ptr<KDecoration3::DecorationShadow> g_sShadow;
-    static std::shared_ptr<KDecoration3::DecorationShadow> g_sShadowInactive;
+    // blur region rebuilds, enable with QT_LOGGING_RULES="breezeenhanced.blurregion.debug=true"
+    Q_LOGGING_CATEGORY(BREEZE_BLUR_REGION, "breezeenhanced.blurregion", QtWarningMsg)
+
+    //* blur region update counters, for all decorations
+    static struct
+    {
+        //* regions built from scratch
+        int full = 0;
+
+        //* regions derived from the previous one after a resize
+        int incremental = 0;
+    } g_blurRegionStatistics;
 
     //________________________________________________________________
     Decoration::Decoration(QObject *parent, const QVariantList &args)
         : KDecoration3::Decoration(parent, args)
-    {
-        g_sDecoCount++;
-    }
+    {}
 
     //________________________________________________________________
     Decoration::~Decoration()
-    {
-        g_sDecoCount--;
-        if (g_sDecoCount == 0) {
-            // last deco destroyed, clean up shadow
-            g_sShadow.reset();
-            g_sShadowInactive.reset();
-        }
-    }
+    {}
 
     //________________________________________________________________
     QColor Decoration::titleBarColor() const
@@ -190,65 +159,61 @@ namespace Breeze
     {
         const auto w = window();
 
-        reconfigure();
-        updateTitleBar();
+        /*
+         * borders are recalculated right away: KWin computes the new window geometry from them
+         * within the same maximize, shade or configuration change. The rest of the derived geometry
+         * is recomputed once per event loop turn, however many signals asked for it
+         */
         auto s = settings();
-        connect(s.get(), &KDecoration3::DecorationSettings::borderSizeChanged, this, &Decoration::recalculateBorders);
+        auto schedule = [this](int flags) { return [this, flags]() { scheduleGeometryUpdate(flags); }; };
+        auto recalculate = [this](int flags) { return [this, flags]() { recalculateBorders(); scheduleGeometryUpdate(flags); }; };
 
         // a change in font might cause the borders to change
-        recalculateBorders();
-        resetBlurRegion();
+        connect(s.get(), &KDecoration3::DecorationSettings::borderSizeChanged, this, recalculate(BlurRegionDirty));
         connect(s.get(), &KDecoration3::DecorationSettings::fontChanged, this, &Decoration::recalculateBorders);
-        connect(s.get(), &KDecoration3::DecorationSettings::spacingChanged, this, &Decoration::recalculateBorders);
+        connect(s.get(), &KDecoration3::DecorationSettings::spacingChanged, this, recalculate(ButtonsDirty|BlurRegionDirty));
 
         // buttons
-        connect(s.get(), &KDecoration3::DecorationSettings::spacingChanged, this, &Decoration::updateButtonsGeometryDelayed);
-        connect(s.get(), &KDecoration3::DecorationSettings::decorationButtonsLeftChanged, this, &Decoration::updateButtonsGeometryDelayed);
-        connect(s.get(), &KDecoration3::DecorationSettings::decorationButtonsRightChanged, this, &Decoration::updateButtonsGeometryDelayed);
+        connect(s.get(), &KDecoration3::DecorationSettings::decorationButtonsLeftChanged, this, schedule(ButtonsDirty));
+        connect(s.get(), &KDecoration3::DecorationSettings::decorationButtonsRightChanged, this, schedule(ButtonsDirty));
 
         // full reconfiguration
         connect(s.get(), &KDecoration3::DecorationSettings::reconfigured, this, &Decoration::reconfigure);
         connect(s.get(), &KDecoration3::DecorationSettings::reconfigured, SettingsProvider::self(), &SettingsProvider::reconfigure, Qt::UniqueConnection);
-        connect(s.get(), &KDecoration3::DecorationSettings::reconfigured, this, &Decoration::updateButtonsGeometryDelayed);
+        connect(s.get(), &KDecoration3::DecorationSettings::reconfigured, ButtonCache::self(), &ButtonCache::clear, Qt::UniqueConnection);
 
-        connect(w, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, &Decoration::recalculateBorders);
-        connect(w, &KDecoration3::DecoratedWindow::maximizedHorizontallyChanged, this, &Decoration::recalculateBorders);
-        connect(w, &KDecoration3::DecoratedWindow::maximizedVerticallyChanged, this, &Decoration::recalculateBorders);
-        connect(w, &KDecoration3::DecoratedWindow::shadedChanged, this, &Decoration::recalculateBorders);
-
-        connect(w, &KDecoration3::DecoratedWindow::captionChanged, this, [this]() {
-            // update the caption area
-            update(titleBar());
-        });
+        // caption changes are throttled, and only repaint the caption area
+        m_caption = w->caption();
+        m_captionTimer = new QTimer(this);
+        m_captionTimer->setSingleShot(true);
+        connect(m_captionTimer, &QTimer::timeout, this, &Decoration::applyCaption);
+        connect(w, &KDecoration3::DecoratedWindow::captionChanged, this, &Decoration::updateCaption);
 
         connect(w, &KDecoration3::DecoratedWindow::activeChanged, this, &Decoration::updateActiveState);
-        connect(this, &KDecoration3::Decoration::bordersChanged, this, &Decoration::updateTitleBar);
-        connect(w, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, &Decoration::updateTitleBar);
-        connect(w, &KDecoration3::DecoratedWindow::widthChanged, this, &Decoration::updateTitleBar);
-        connect(w, &KDecoration3::DecoratedWindow::maximizedChanged, this, &Decoration::updateTitleBar);
-        //connect(w, &KDecoration3::DecoratedWindow::maximizedChanged, this, &Decoration::setOpaque);
-
-        connect(w, &KDecoration3::DecoratedWindow::widthChanged, this, &Decoration::updateButtonsGeometry);
-        connect(w, &KDecoration3::DecoratedWindow::maximizedChanged, this, &Decoration::updateButtonsGeometry);
-        connect(w, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, &Decoration::updateButtonsGeometry);
-        connect(w, &KDecoration3::DecoratedWindow::shadedChanged, this, &Decoration::updateButtonsGeometry);
-
-        connect(s.get(), &KDecoration3::DecorationSettings::borderSizeChanged, this, &Decoration::resetBlurRegion);
-        connect(s.get(), &KDecoration3::DecorationSettings::spacingChanged, this, &Decoration::resetBlurRegion);
-        connect(w, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, &Decoration::resetBlurRegion);
-        connect(w, &KDecoration3::DecoratedWindow::maximizedHorizontallyChanged, this, &Decoration::resetBlurRegion);
-        connect(w, &KDecoration3::DecoratedWindow::maximizedVerticallyChanged, this, &Decoration::resetBlurRegion);
-        connect(w, &KDecoration3::DecoratedWindow::maximizedChanged, this, &Decoration::resetBlurRegion);
-        connect(w, &KDecoration3::DecoratedWindow::shadedChanged, this, &Decoration::resetBlurRegion);
-        connect(w, &KDecoration3::DecoratedWindow::widthChanged, this, &Decoration::resetBlurRegion);
+
+        // the opaque state follows the geometry, see updateOpaque
+        connect(this, &KDecoration3::Decoration::bordersChanged, this, schedule(TitleBarDirty|OpaqueDirty));
+        connect(w, &KDecoration3::DecoratedWindow::adjacentScreenEdgesChanged, this, recalculate(TitleBarDirty|ButtonsDirty|BlurRegionDirty|OpaqueDirty));
+        connect(w, &KDecoration3::DecoratedWindow::maximizedHorizontallyChanged, this, recalculate(BlurRegionDirty));
+        connect(w, &KDecoration3::DecoratedWindow::maximizedVerticallyChanged, this, recalculate(BlurRegionDirty));
+        connect(w, &KDecoration3::DecoratedWindow::maximizedChanged, this, schedule(TitleBarDirty|ButtonsDirty|BlurRegionDirty|OpaqueDirty));
+        connect(w, &KDecoration3::DecoratedWindow::shadedChanged, this, recalculate(ButtonsDirty|BlurRegionDirty|OpaqueDirty));
+
+        // buttons follow an interactive resize in the same frame
+        connect(w, &KDecoration3::DecoratedWindow::widthChanged, this, [this]() {
+            if (m_leftButtons && m_rightButtons) updateButtonsGeometry();
+            scheduleGeometryUpdate(TitleBarDirty|BlurRegionDirty|OpaqueDirty);
+        });
         connect(w, &KDecoration3::DecoratedWindow::heightChanged, this, [this]() {
-            if (!hasNoSideBorders()) resetBlurRegion();
+            scheduleGeometryUpdate(OpaqueDirty | (hasNoSideBorders() ? 0 : BlurRegionDirty));
         });
 
         connect(window(), &KDecoration3::DecoratedWindow::nextScaleChanged, this, &Decoration::updateScale);
 
+        // everything is computed right away on creation
+        reconfigure();
         createButtons();
-        updateShadow();
+        updateGeometry();
 
         return true;
     }
@@ -269,7 +234,7 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::updateActiveState()
     {
-        updateShadow(); // active and inactive shadows are different
+        scheduleGeometryUpdate(ShadowDirty); // active and inactive shadows are different
         update();
     }
 
@@ -333,17 +298,15 @@ namespace Breeze
     {
 
         m_internalSettings = SettingsProvider::self()->internalSettings(this);
+        m_titleBarFont = SettingsProvider::self()->titleBarFont(m_internalSettings);
 
         setScaledCornerRadius();
 
         // borders
         recalculateBorders();
 
-        // blur region
-        resetBlurRegion();
-
-        // shadow
-        updateShadow();
+        // buttons, blur region, opaque state and shadow
+        scheduleGeometryUpdate(TitleBarDirty|ButtonsDirty|BlurRegionDirty|ShadowDirty|OpaqueDirty);
 
     }
 
@@ -363,9 +326,7 @@ namespace Breeze
             top = bottom;
         else
         {
-            QFont f; f.fromString(m_internalSettings->titleBarFont());
-            QFontMetricsF fm(f);
-            top += KDecoration3::snapToPixelGrid(std::max(fm.height(), static_cast<qreal>(buttonSize())), scale);
+            top += KDecoration3::snapToPixelGrid(std::max(m_titleBarFont->height(), static_cast<qreal>(buttonSize())), scale);
 
             // padding below
             // extra pixel is used for the active window outline (but not in the shaded state)
@@ -408,15 +369,102 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::resetBlurRegion()
     {
-        // NOTE: "BlurEffect::decorationBlurRegion()" will consider the intersection of
-        // the blur and decoration regions. Here we need to focus on corner rounding.
-
         if (titleBarAlpha() == 255 || !settings()->isAlphaChannelSupported())
         { // no blurring without translucency
+            m_blurRegion = QRegion();
+            m_blurRegionShape = BlurRegionShape();
             setBlurRegion(QRegion());
             return;
         }
 
+        // resizing only moves the right and bottom corners, and stretches the rects in between
+        const BlurRegionShape shape(blurRegionShape());
+        const bool incremental = updateBlurRegion(shape);
+        if (incremental) ++g_blurRegionStatistics.incremental;
+        else {
+            m_blurRegion = createBlurRegion();
+            ++g_blurRegionStatistics.full;
+        }
+
+        qCDebug(BREEZE_BLUR_REGION) << (incremental ? "incremental" : "full") << "blur region update for" << size()
+                                    << "- totals:" << g_blurRegionStatistics.incremental << "incremental,"
+                                    << g_blurRegionStatistics.full << "full";
+
+        m_blurRegionShape = shape;
+        m_blurRegionSize = size();
+        setBlurRegion(m_blurRegion);
+    }
+
+    //________________________________________________________________
+    void Decoration::updateOpaque()
+    {
+        const auto w = window();
+        auto s = settings();
+
+        // title bar and frame share the same alpha, and are opaque as a whole without an alpha channel
+        const bool opaqueColor = titleBarAlpha() == 255 || !s->isAlphaChannelSupported();
+
+        /*
+         * rounded corners are translucent. The title bar ones are square when maximized,
+         * and the bottom ones then lie inside the client area anyway
+         */
+        const bool rounded = m_scaledCornerRadius > 0 && s->isAlphaChannelSupported() && (hideTitleBar() || !isMaximized());
+
+        // pixels only partially covered by the decoration are left out
+        const QRect frame(0, 0, std::floor(size().width()), std::floor(size().height()));
+        const bool hasFrame = !frame.isEmpty() && (w->isShaded() || !rect().marginsRemoved(borders()).toAlignedRect().contains(frame));
+
+        // KWin can skip blending for fully opaque decorations
+        setOpaque(opaqueColor && !rounded && hasFrame);
+    }
+
+    //________________________________________________________________
+    Decoration::BlurRegionShape Decoration::blurRegionShape() const
+    {
+        BlurRegionShape shape;
+        shape.valid = true;
+        shape.shaded = window()->isShaded();
+        shape.maximized = isMaximized();
+        shape.hasBorders = hasBorders();
+        shape.hasNoBorders = hasNoBorders();
+        shape.hideTitleBar = hideTitleBar();
+        if (isLeftEdge()) shape.edges |= Qt::LeftEdge;
+        if (isRightEdge()) shape.edges |= Qt::RightEdge;
+        if (isTopEdge()) shape.edges |= Qt::TopEdge;
+        if (isBottomEdge()) shape.edges |= Qt::BottomEdge;
+        shape.radius = m_scaledCornerRadius;
+        shape.borderTop = borderTop();
+        return shape;
+    }
+
+    //________________________________________________________________
+    bool Decoration::updateBlurRegion(const BlurRegionShape &shape)
+    {
+        if (!(shape.valid && shape == m_blurRegionShape)) return false;
+
+        // rects are rounded from fractional geometry. Only whole pixel resizes move them by the same amount
+        const QSizeF delta(size() - m_blurRegionSize);
+        const int dx = qRound(delta.width());
+        const int dy = qRound(delta.height());
+        if (qAbs(delta.width() - dx) > 1e-3 || qAbs(delta.height() - dy) > 1e-3) return false;
+
+        // rows and columns are stretched away from the corners and the title bar, where all of them are identical
+        const int corner = std::ceil(2*shape.radius) + 1;
+        const int cutX = corner;
+        const int cutY = std::ceil(shape.borderTop + 2*shape.radius) + 1;
+        if (dx && cutX + corner >= qMin(size().width(), m_blurRegionSize.width()) - 1) return false;
+        if (dy && cutY + corner >= qMin(size().height(), m_blurRegionSize.height()) - 1) return false;
+
+        m_blurRegion = stretchRegion(stretchRegion(m_blurRegion, Qt::Horizontal, cutX, dx), Qt::Vertical, cutY, dy);
+        return true;
+    }
+
+    //________________________________________________________________
+    QRegion Decoration::createBlurRegion() const
+    {
+        // NOTE: "BlurEffect::decorationBlurRegion()" will consider the intersection of
+        // the blur and decoration regions. Here we need to focus on corner rounding.
+
         QRegion region;
         const auto w = window();
         QSizeF rSize(m_scaledCornerRadius, m_scaledCornerRadius);
@@ -434,11 +482,9 @@ namespace Breeze
             {
                 if (hideTitleBar())
                 {
-                    topLeft = QRegion(QRectF(rect.topLeft(), 2*rSize).toRect(),
-                                      isLeftEdge() ? QRegion::Rectangle : QRegion::Ellipse);
-                    topRight = QRegion(QRectF(rect.topLeft() + QPointF(rect.width() - 2*m_scaledCornerRadius, 0),
-                                              2*rSize).toRect(),
-                                       isRightEdge() ? QRegion::Rectangle : QRegion::Ellipse);
+                    topLeft = blurCorner(QRectF(rect.topLeft(), 2*rSize), !isLeftEdge());
+                    topRight = blurCorner(QRectF(rect.topLeft() + QPointF(rect.width() - 2*m_scaledCornerRadius, 0), 2*rSize),
+                                          !isRightEdge());
                     horiz = QRegion(QRectF(rect.topLeft() + QPointF(0, m_scaledCornerRadius),
                                            QSizeF(rect.width(), rect.height() - 2*m_scaledCornerRadius)).toRect());
                 }
@@ -447,25 +493,23 @@ namespace Breeze
                     horiz = QRegion(QRectF(rect.topLeft(),
                                            QSizeF(rect.width(), rect.height() - m_scaledCornerRadius)).toRect());
                 }
-                bottomLeft = QRegion(QRectF(rect.topLeft() + QPointF(0, rect.height() - 2*m_scaledCornerRadius),
-                                            2*rSize).toRect(),
-                                     isLeftEdge() && isBottomEdge() ? QRegion::Rectangle : QRegion::Ellipse);
-                bottomRight = QRegion(QRectF(rect.topLeft() + QPointF(rect.width() - 2*m_scaledCornerRadius,
-                                                                    rect.height() - 2*m_scaledCornerRadius),
-                                            2*rSize).toRect(),
-                                      isRightEdge() && isBottomEdge() ? QRegion::Rectangle : QRegion::Ellipse);
+                bottomLeft = blurCorner(QRectF(rect.topLeft() + QPointF(0, rect.height() - 2*m_scaledCornerRadius), 2*rSize),
+                                        !(isLeftEdge() && isBottomEdge()));
+                bottomRight = blurCorner(QRectF(rect.topLeft() + QPointF(rect.width() - 2*m_scaledCornerRadius,
+                                                                         rect.height() - 2*m_scaledCornerRadius),
+                                                2*rSize),
+                                         !(isRightEdge() && isBottomEdge()));
             }
             else // no side border
             {
                 horiz = QRegion(QRectF(rect.topLeft(),
                                        QSizeF(rect.width(), rect.height() - m_scaledCornerRadius)).toRect());
-                bottomLeft = QRegion(QRectF(rect.topLeft() + QPointF(0, rect.height() - 2*m_scaledCornerRadius),
-                                            2*rSize).toRect(),
-                                     isBottomEdge() ? QRegion::Rectangle : QRegion::Ellipse);
-                bottomRight = QRegion(QRectF(rect.topLeft() + QPointF(rect.width() - 2*m_scaledCornerRadius,
-                                                                      rect.height() - 2*m_scaledCornerRadius),
-                                             2*rSize).toRect(),
-                                      isBottomEdge() ? QRegion::Rectangle : QRegion::Ellipse);
+                bottomLeft = blurCorner(QRectF(rect.topLeft() + QPointF(0, rect.height() - 2*m_scaledCornerRadius), 2*rSize),
+                                        !isBottomEdge());
+                bottomRight = blurCorner(QRectF(rect.topLeft() + QPointF(rect.width() - 2*m_scaledCornerRadius,
+                                                                         rect.height() - 2*m_scaledCornerRadius),
+                                                2*rSize),
+                                         !isBottomEdge());
             }
 
             region = topLeft
@@ -475,11 +519,7 @@ namespace Breeze
                      .united(horiz)
                      .united(vert);
 
-            if (hideTitleBar())
-            {
-                setBlurRegion(region);
-                return;
-            }
+            if (hideTitleBar()) return region;
         }
 
         const QRectF titleRect(QPointF(0, 0), QSizeF(size().width(), borderTop()));
@@ -492,17 +532,13 @@ namespace Breeze
         }
         else if (w->isShaded())
         {
-            QRegion topLeft(QRectF(titleRect.topLeft(), 2*rSize).toRect(), QRegion::Ellipse);
-            QRegion topRight(QRectF(titleRect.topLeft() + QPointF(titleRect.width() - 2*m_scaledCornerRadius, 0),
-                                    2*rSize).toRect(),
-                             QRegion::Ellipse);
-            QRegion bottomLeft(QRectF(titleRect.topLeft() + QPointF(0, titleRect.height() - 2*m_scaledCornerRadius),
-                                      2*rSize).toRect(),
-                               QRegion::Ellipse);
-            QRegion bottomRight(QRectF(titleRect.topLeft() + QPointF(titleRect.width() - 2*m_scaledCornerRadius,
-                                                                     titleRect.height() - 2*m_scaledCornerRadius),
-                                       2*rSize).toRect(),
-                                QRegion::Ellipse);
+            const QRegion topLeft(blurCorner(QRectF(titleRect.topLeft(), 2*rSize), true));
+            const QRegion topRight(blurCorner(QRectF(titleRect.topLeft() + QPointF(titleRect.width() - 2*m_scaledCornerRadius, 0), 2*rSize), true));
+            const QRegion bottomLeft(blurCorner(QRectF(titleRect.topLeft() + QPointF(0, titleRect.height() - 2*m_scaledCornerRadius), 2*rSize), true));
+            const QRegion bottomRight(blurCorner(QRectF(titleRect.topLeft() + QPointF(titleRect.width() - 2*m_scaledCornerRadius,
+                                                                                      titleRect.height() - 2*m_scaledCornerRadius),
+                                                        2*rSize),
+                                                 true));
             region = topLeft
                      .united(topRight)
                      .united(bottomLeft)
@@ -516,11 +552,9 @@ namespace Breeze
         }
         else
         {
-            QRegion topLeft(QRectF(titleRect.topLeft(), 2*rSize).toRect(),
-                            isLeftEdge() || isTopEdge() ? QRegion::Rectangle : QRegion::Ellipse);
-            QRegion topRight(QRectF(titleRect.topLeft() + QPointF(titleRect.width() - 2*m_scaledCornerRadius, 0),
-                                    2*rSize).toRect(),
-                             isRightEdge() || isTopEdge() ? QRegion::Rectangle : QRegion::Ellipse);
+            const QRegion topLeft(blurCorner(QRectF(titleRect.topLeft(), 2*rSize), !(isLeftEdge() || isTopEdge())));
+            const QRegion topRight(blurCorner(QRectF(titleRect.topLeft() + QPointF(titleRect.width() - 2*m_scaledCornerRadius, 0), 2*rSize),
+                                              !(isRightEdge() || isTopEdge())));
             region |= topLeft
                       .united(topRight)
                       // vertical
@@ -531,7 +565,7 @@ namespace Breeze
                                      QSizeF(titleRect.width(), titleRect.height() - m_scaledCornerRadius)).toRect());
         }
 
-        setBlurRegion(region);
+        return region;
     }
 
     //________________________________________________________________
@@ -539,13 +573,45 @@ namespace Breeze
     {
         m_leftButtons = new KDecoration3::DecorationButtonGroup(KDecoration3::DecorationButtonGroup::Position::Left, this, &Button::create);
         m_rightButtons = new KDecoration3::DecorationButtonGroup(KDecoration3::DecorationButtonGroup::Position::Right, this, &Button::create);
-        updateButtonsGeometry();
+        scheduleGeometryUpdate(ButtonsDirty);
+    }
+
+    //________________________________________________________________
+    void Decoration::scheduleGeometryUpdate(int flags)
+    {
+        m_dirtyGeometry |= flags;
+        if (m_geometryUpdateScheduled) return;
+
+        m_geometryUpdateScheduled = true;
+        QTimer::singleShot(0, this, &Decoration::updateGeometry);
     }
 
     //________________________________________________________________
-    void Decoration::updateButtonsGeometryDelayed()
+    void Decoration::updateGeometry()
     {
-        QTimer::singleShot(0, this, &Decoration::updateButtonsGeometry);
+        // requests made while updating are served in this pass when possible
+        m_geometryUpdateScheduled = true;
+
+        /*
+         * steps run in dependency order, the regions after the title bar they are built from.
+         * Flags are tested one at a time so that a step may still mark the following ones as dirty.
+         */
+        auto take = [this](int flag)
+        {
+            const bool dirty = m_dirtyGeometry & flag;
+            m_dirtyGeometry &= ~flag;
+            return dirty;
+        };
+
+        if (take(TitleBarDirty)) updateTitleBar();
+        if (take(ButtonsDirty) && m_leftButtons && m_rightButtons) updateButtonsGeometry();
+        if (take(BlurRegionDirty)) resetBlurRegion();
+        if (take(OpaqueDirty)) updateOpaque();
+        if (take(ShadowDirty)) updateShadow();
+
+        // anything marked dirty after its step is left for the next turn
+        m_geometryUpdateScheduled = false;
+        if (m_dirtyGeometry) scheduleGeometryUpdate(0);
     }
 
     //________________________________________________________________
@@ -625,38 +691,45 @@ namespace Breeze
     //________________________________________________________________
     void Decoration::paint(QPainter *painter, const QRectF &repaintRegion)
     {
-        // TODO: optimize based on repaintRegion
+        // only what intersects the damaged area is painted, and fills are clipped to it
+        const QRectF damage = repaintRegion.intersected(rect());
+        if (damage.isEmpty()) return;
+
         const auto w = window();
         auto s = settings();
 
+        // the client covers everything inside the borders
+        if (rect().marginsRemoved(borders()).contains(damage)) return;
+
         // paint background
-        if (!w->isShaded())
+        const QRectF backgroundRect = hideTitleBar() ? rect() : QRectF(0, borderTop(), size().width(), size().height() - borderTop());
+        if (!w->isShaded() && backgroundRect.intersects(damage))
         {
-            painter->fillRect(rect(), Qt::transparent);
             painter->save();
-            painter->setRenderHint(QPainter::Antialiasing);
-            painter->setPen(Qt::NoPen);
-
-            QColor winCol = this->titleBarColor();
-            winCol.setAlpha(titleBarAlpha());
-            painter->setBrush(winCol);
+            painter->setClipRect(damage, Qt::IntersectClip);
 
             // clip away the top part
             if (!hideTitleBar())
-                painter->setClipRect(QRectF(0, borderTop(), size().width(), size().height() - borderTop()), Qt::IntersectClip);
+                painter->setClipRect(backgroundRect, Qt::IntersectClip);
 
-            if (s->isAlphaChannelSupported())
-                painter->drawRoundedRect(rect(), m_scaledCornerRadius, m_scaledCornerRadius);
-            else
-                painter->drawRect(rect());
+            // only the border ring is painted, with pre-rendered rounded corners
+            QColor winCol = this->titleBarColor();
+            winCol.setAlpha(titleBarAlpha());
+
+            FrameKey key;
+            key.radius = s->isAlphaChannelSupported() ? m_scaledCornerRadius : 0;
+            key.color = winCol.rgba();
+            key.scale = painter->device() ? painter->device()->devicePixelRatio() : 1.0;
+            FrameCache::self()->paint(painter, rect(), borders(), key);
 
             painter->restore();
         }
 
         if (!hideTitleBar())
-            paintTitleBar(painter, repaintRegion);
+            paintTitleBar(painter, damage);
 
-        if (hasBorders() && !s->isAlphaChannelSupported())
+        // the one pixel border is only painted if the damage reaches it
+        if (hasBorders() && !s->isAlphaChannelSupported() && !rect().adjusted(1, 1, -1, -1).contains(damage))
         {
             painter->save();
             painter->setRenderHint(QPainter::Antialiasing, false);
@@ -678,72 +751,53 @@ namespace Breeze
 
         if (!titleRect.intersects(repaintRegion)) return;
 
-        painter->save();
-        painter->setPen(Qt::NoPen);
-
-        // render a linear gradient on title area and draw a light border at the top
-        if (m_internalSettings->drawBackgroundGradient() && !flatTitleBar())
-        {
-            QColor titleBarColor(this->titleBarColor());
-            titleBarColor.setAlpha(titleBarAlpha());
-
-            QLinearGradient gradient(0, 0, 0, titleRect.height());
-            QColor lightCol(titleBarColor.lighter(130 + m_internalSettings->backgroundGradientIntensity()));
-            gradient.setColorAt(0.0, lightCol);
-            gradient.setColorAt(0.99 / titleRect.height(), lightCol);
-            gradient.setColorAt(1.0 / titleRect.height(),
-                                titleBarColor.lighter(100 + m_internalSettings->backgroundGradientIntensity()));
-            gradient.setColorAt(1.0, titleBarColor);
-
-            painter->setBrush(gradient);
-        }
-        else
-        {
-            QColor titleBarColor(this->titleBarColor());
-            titleBarColor.setAlpha(titleBarAlpha());
+        // the background is composed from a cached texture, it is only rasterized when its key changes
+        QColor titleBarColor(this->titleBarColor());
+        titleBarColor.setAlpha(titleBarAlpha());
 
-            QLinearGradient gradient(0, 0, 0, titleRect.height());
-            QColor lightCol(titleBarColor.lighter(130));
-            gradient.setColorAt(0.0, lightCol);
-            gradient.setColorAt(0.99 / titleRect.height(), lightCol);
-            gradient.setColorAt(1.0 / titleRect.height(), titleBarColor);
-            gradient.setColorAt(1.0, titleBarColor);
-
-            painter->setBrush(gradient);
-        }
+        TitleBarKey key;
+        key.height = titleRect.height();
+        key.color = titleBarColor.rgba();
+        key.gradient = m_internalSettings->drawBackgroundGradient() && !flatTitleBar();
+        key.intensity = key.gradient ? m_internalSettings->backgroundGradientIntensity() : 0;
+        key.scale = painter->device() ? painter->device()->devicePixelRatio() : 1.0;
 
         auto s = settings();
-        if (isMaximized() || !s->isAlphaChannelSupported())
-        {
-            painter->drawRect(titleRect);
-        }
-        else if (w->isShaded())
-        {
-            painter->drawRoundedRect(titleRect, m_scaledCornerRadius, m_scaledCornerRadius);
-        }
-        else
+        if (!isMaximized() && s->isAlphaChannelSupported())
         {
-            painter->setClipRect(titleRect, Qt::IntersectClip);
-            // the rect is made a little bit larger to be able to clip away the rounded corners at the bottom and sides
-            painter->drawRoundedRect(titleRect.adjusted(isLeftEdge() ? -m_scaledCornerRadius :0,
-                                                        isTopEdge() ? -m_scaledCornerRadius :0,
-                                                        isRightEdge() ? m_scaledCornerRadius :0,
-                                                        m_scaledCornerRadius),
-                                     m_scaledCornerRadius, m_scaledCornerRadius);
+            key.radius = m_scaledCornerRadius;
 
+            // the rect is made a little bit larger to be able to clip away the rounded corners at the bottom and sides
+            if (!w->isShaded())
+            {
+                if (isLeftEdge()) key.edges |= Qt::LeftEdge;
+                if (isTopEdge()) key.edges |= Qt::TopEdge;
+                if (isRightEdge()) key.edges |= Qt::RightEdge;
+                key.edges |= Qt::BottomEdge;
+            }
         }
 
+        painter->save();
+        painter->setClipRect(repaintRegion, Qt::IntersectClip);
+        TitleBarCache::paint(painter, titleRect, TitleBarCache::self()->texture(key));
         painter->restore();
 
         // draw caption
-        QFont f; f.fromString(m_internalSettings->titleBarFont());
-        // KDE needs this FIXME: Why?
-        QFontDatabase fd; f.setStyleName(fd.styleString(f));
-        painter->setFont(f);
-        painter->setPen(fontColor());
         const auto cR = captionRect();
-        const QString caption = painter->fontMetrics().elidedText(w->caption(), Qt::ElideMiddle, cR.first.width());
-        painter->drawText(cR.first, cR.second | Qt::TextSingleLine, caption);
+        if (cR.first.intersects(repaintRegion))
+        {
+            // the caption is only shaped again when it, the font or the available width change
+            const QStaticText &caption = captionLayout().text(cR.first.width());
+            const QSizeF captionSize = caption.size();
+
+            QPointF position(cR.first.left(), cR.first.center().y() - captionSize.height()/2);
+            if (cR.second & Qt::AlignRight) position.setX(cR.first.right() - captionSize.width());
+            else if (cR.second & Qt::AlignHCenter) position.setX(cR.first.center().x() - captionSize.width()/2);
+
+            painter->setFont(m_titleBarFont->paintFont());
+            painter->setPen(fontColor());
+            painter->drawStaticText(position, caption);
+        }
 
         // draw all buttons
         m_leftButtons->paint(painter, repaintRegion);
@@ -783,7 +837,6 @@ namespace Breeze
         else {
 
             const qreal extraTitleMargin = m_internalSettings->extraTitleMargin();
-            const auto w = window();
             const qreal leftOffset = m_leftButtons->buttons().isEmpty() ?
                 Metrics::TitleBar_SideMargin*settings()->smallSpacing() + extraTitleMargin :
                 m_leftButtons->geometry().x() + m_leftButtons->geometry().width() + Metrics::TitleBar_SideMargin*settings()->smallSpacing() + extraTitleMargin;
@@ -812,13 +865,8 @@ namespace Breeze
 
                     // full caption rect
                     const QRectF fullRect = QRectF(0, yOffset, size().width(), captionHeight());
-                    QFont f; f.fromString(m_internalSettings->titleBarFont());
-                    QFontMetricsF fm(f);
-                    QRectF boundingRect(fm.boundingRect(w->caption()));
-
                     // text bounding rect
-                    boundingRect.setTop(yOffset);
-                    boundingRect.setHeight(captionHeight());
+                    QRectF boundingRect(0, yOffset, captionLayout().width(), captionHeight());
                     boundingRect.moveLeft((size().width() - boundingRect.width())/2);
 
                     if (boundingRect.left() < leftOffset)
@@ -836,94 +884,68 @@ namespace Breeze
 
     }
 
+    //________________________________________________________________
+    void Decoration::updateCaption()
+    {
+        // a pending update will pick the latest caption
+        if (m_captionTimer->isActive()) return;
+
+        const qint64 interval = m_internalSettings->captionThrottleInterval();
+        const qint64 elapsed = m_captionUpdated.isValid() ? m_captionUpdated.elapsed() : interval;
+        if (elapsed >= interval) applyCaption();
+        else m_captionTimer->start(int(interval - elapsed));
+    }
+
+    //________________________________________________________________
+    void Decoration::applyCaption()
+    {
+        m_captionUpdated.start();
+
+        const QString caption = window()->caption();
+        if (caption == m_caption) return;
+
+        // repaint the union of the old and new caption areas
+        const QRectF oldRect = captionRect().first;
+        m_caption = caption;
+        const QRectF newRect = captionRect().first;
+
+        const QRectF damage = oldRect.united(newRect);
+        if (!damage.isEmpty()) update(damage);
+    }
+
+    //________________________________________________________________
+    CaptionLayout &Decoration::captionLayout() const
+    {
+        m_captionLayout.setFont(m_titleBarFont);
+        m_captionLayout.setCaption(m_caption);
+        return m_captionLayout;
+    }
+
     //________________________________________________________________
     void Decoration::updateShadow()
     {
         const auto w = window();
-        auto &shadow = w->isActive() ? g_sShadow : g_sShadowInactive;
 
-        if (!shadow
-            || g_shadowSizeEnum != m_internalSettings->shadowSize()
-            || g_shadowStrength != m_internalSettings->shadowStrength()
-            || g_shadowColor != m_internalSettings->shadowColor())
+        ShadowKey key;
+        key.size = m_internalSettings->shadowSize();
+        key.strength = m_internalSettings->shadowStrength();
+        key.color = m_internalSettings->shadowColor().rgba();
+        key.radius = m_scaledCornerRadius;
+        key.active = w->isActive();
+
+        // the shadow of the other active state is kept around for focus changes, unless its settings are outdated
+        ShadowKey other(key);
+        other.active = !key.active;
+        if (!(other == m_shadowKey || key == m_shadowKey))
         {
-            g_shadowSizeEnum = m_internalSettings->shadowSize();
-            g_shadowStrength = m_internalSettings->shadowStrength();
-            g_shadowColor = m_internalSettings->shadowColor();
-
-            const CompositeShadowParams params = lookupShadowParams(g_shadowSizeEnum);
-            if (params.isNone()) {
-                g_sShadow.reset();
-                g_sShadowInactive.reset();
-                setShadow(shadow);
-                return;
-            }
-
-            auto withOpacity = [](const QColor &color, qreal opacity) -> QColor {
-                QColor c(color);
-                c.setAlphaF(opacity);
-                return c;
-            };
-
-            const QSize boxSize = BoxShadowRenderer::calculateMinimumBoxSize(params.shadow1.radius)
-                .expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(params.shadow2.radius));
-
-            BoxShadowRenderer shadowRenderer;
-            shadowRenderer.setBorderRadius(m_scaledCornerRadius + 0.5);
-            shadowRenderer.setBoxSize(boxSize);
-
-            const qreal strength = static_cast<qreal>(g_shadowStrength) / 255.0 * (w->isActive() ? 1.0 : 0.5);
-            shadowRenderer.addShadow(params.shadow1.offset, params.shadow1.radius,
-                withOpacity(g_shadowColor, params.shadow1.opacity * strength));
-            shadowRenderer.addShadow(params.shadow2.offset, params.shadow2.radius,
-                withOpacity(g_shadowColor, params.shadow2.opacity * strength));
-
-            QImage shadowTexture = shadowRenderer.render();
-
-            QPainter painter(&shadowTexture);
-            painter.setRenderHint(QPainter::Antialiasing);
-
-            const QRectF outerRect = shadowTexture.rect();
-
-            QRectF boxRect(QPointF(0, 0), boxSize);
-            boxRect.moveCenter(outerRect.center());
-
-            // Mask out inner rect.
-            const QMarginsF padding = QMarginsF(
-                boxRect.left() - outerRect.left() - Metrics::Shadow_Overlap - params.offset.x(),
-                boxRect.top() - outerRect.top() - Metrics::Shadow_Overlap - params.offset.y(),
-                outerRect.right() - boxRect.right() - Metrics::Shadow_Overlap + params.offset.x(),
-                outerRect.bottom() - boxRect.bottom() - Metrics::Shadow_Overlap + params.offset.y());
-            const QRectF innerRect = outerRect - padding;
-            // Push the shadow slightly under the window, which helps avoiding glitches with fractional scaling
-            // TODO fix this more properly
-            //innerRect.adjust(2, 2, -2, -2);
-
-            painter.setPen(Qt::NoPen);
-            painter.setBrush(Qt::black);
-            painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
-            painter.drawRoundedRect(
-                innerRect,
-                m_scaledCornerRadius + 0.5,
-                m_scaledCornerRadius + 0.5);
-
-            // Draw outline.
-            painter.setPen(withOpacity(g_shadowColor, 0.2 * strength));
-            painter.setBrush(Qt::NoBrush);
-            painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
-            painter.drawRoundedRect(
-                innerRect,
-                m_scaledCornerRadius - 0.5,
-                m_scaledCornerRadius - 0.5);
-
-            painter.end();
-
-            shadow = std::make_shared<KDecoration3::DecorationShadow>();
-            shadow->setPadding(padding);
-            shadow->setInnerShadowRect(QRectF(outerRect.center(), QSizeF(1, 1)));
-            shadow->setShadow(shadowTexture);
+            m_activeShadow.reset();
+            m_inactiveShadow.reset();
         }
 
+        auto &shadow = key.active ? m_activeShadow : m_inactiveShadow;
+        shadow = ShadowCache::self()->shadow(key);
+        m_shadowKey = key;
+
         setShadow(shadow);
     }
 
@@ -941,6 +963,7 @@ namespace Breeze
     {
         setScaledCornerRadius();
         recalculateBorders();
+        scheduleGeometryUpdate(OpaqueDirty|ShadowDirty);
     }
 
 } // namespace
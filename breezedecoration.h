@@ -22,16 +22,23 @@
 #pragma once
 
 #include "breeze.h"
+#include "breezecaptionlayout.h"
 #include "breezesettings.h"
+#include "breezeshadowcache.h"
+#include "breezetitlebarfont.h"
 
 #include <KDecoration3/DecoratedWindow>
 #include <KDecoration3/Decoration>
 #include <KDecoration3/DecorationSettings>
 
+#include <QElapsedTimer>
 #include <QPalette>
+#include <QRegion>
 #include <QVariant>
 #include <QVariantAnimation>
 
+class QTimer;
+
 namespace KDecoration3
 {
     class DecorationButton;
@@ -92,17 +99,69 @@ namespace Breeze
         void reconfigure();
         void recalculateBorders();
         void resetBlurRegion();
+        void updateOpaque();
         void updateButtonsGeometry();
-        void updateButtonsGeometryDelayed();
+        void updateCaption();
+        void applyCaption();
         void updateTitleBar();
         void updateActiveState();
         void updateScale();
 
+        //* recompute the derived state marked as dirty, see scheduleGeometryUpdate
+        void updateGeometry();
+
         private:
 
+        //* derived state, recomputed by updateGeometry
+        enum GeometryFlag
+        {
+            TitleBarDirty = 1<<0,
+            ButtonsDirty = 1<<1,
+            BlurRegionDirty = 1<<2,
+            ShadowDirty = 1<<3,
+            OpaqueDirty = 1<<4
+        };
+
+        //* mark derived state as dirty. It is recomputed once, on the next event loop turn
+        void scheduleGeometryUpdate(int flags);
+
         //* return the rect in which caption will be drawn
         QPair<QRectF,Qt::Alignment> captionRect() const;
 
+        //* caption layout, in sync with the window caption and title bar font
+        CaptionLayout &captionLayout() const;
+
+        //* everything the shape of the blur region depends on, but the window size
+        struct BlurRegionShape
+        {
+            bool valid = false;
+            bool shaded = false;
+            bool maximized = false;
+            bool hasBorders = false;
+            bool hasNoBorders = false;
+            bool hideTitleBar = false;
+            Qt::Edges edges;
+            qreal radius = 0;
+            qreal borderTop = 0;
+
+            bool operator == (const BlurRegionShape &other) const
+            {
+                return valid == other.valid && shaded == other.shaded && maximized == other.maximized
+                    && hasBorders == other.hasBorders && hasNoBorders == other.hasNoBorders
+                    && hideTitleBar == other.hideTitleBar && edges == other.edges
+                    && radius == other.radius && borderTop == other.borderTop;
+            }
+        };
+
+        //* current blur region shape
+        BlurRegionShape blurRegionShape() const;
+
+        //* blur region for the current geometry, built from scratch
+        QRegion createBlurRegion() const;
+
+        //* derive the blur region from the previous one, if only the window size changed
+        bool updateBlurRegion(const BlurRegionShape &shape);
+
         void createButtons();
         void paintTitleBar(QPainter *painter, const QRectF &repaintRegion);
         void updateShadow();
@@ -126,9 +185,52 @@ namespace Breeze
         //@}
 
         InternalSettingsPtr m_internalSettings;
+
+        //* title bar font, shared by all decorations with the same internal settings
+        TitleBarFontPtr m_titleBarFont;
+
+        //*@name caption throttling
+        //@{
+
+        //* caption being displayed, which may lag behind the window caption
+        QString m_caption;
+
+        //* pending caption update
+        QTimer *m_captionTimer = nullptr;
+
+        //* time of the last caption update
+        QElapsedTimer m_captionUpdated;
+
+        //@}
+
+        //* shaped and elided caption
+        mutable CaptionLayout m_captionLayout;
+
         KDecoration3::DecorationButtonGroup *m_leftButtons = nullptr;
         KDecoration3::DecorationButtonGroup *m_rightButtons = nullptr;
 
+        //*@name geometry scheduler
+        //@{
+        int m_dirtyGeometry = 0;
+        bool m_geometryUpdateScheduled = false;
+        //@}
+
+        //*@name last blur region, and what it was built for
+        //@{
+        QRegion m_blurRegion;
+        BlurRegionShape m_blurRegionShape;
+        QSizeF m_blurRegionSize;
+        //@}
+
+        //*@name shadows, shared with other decorations through ShadowCache
+        //@{
+        std::shared_ptr<KDecoration3::DecorationShadow> m_activeShadow;
+        std::shared_ptr<KDecoration3::DecorationShadow> m_inactiveShadow;
+
+        //* key of the current shadow
+        ShadowKey m_shadowKey;
+        //@}
+
         //*frame corner radius, scaled according to DPI
         qreal m_scaledCornerRadius = 3;
     };
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezeframecache.h"
+
+#include <QHashFunctions>
+#include <QPainter>
+#include <QtMath>
+
+namespace Breeze
+{
+
+    //* upper bound for the memory used by corners (bytes)
+    static constexpr int s_maxCornerCost = 1024*1024;
+
+    FrameCache *FrameCache::s_self = nullptr;
+
+    //__________________________________________________________________
+    size_t qHash(const FrameKey &key, size_t seed) noexcept
+    { return qHashMulti(seed, qRound(key.radius*64), key.color, qRound(key.scale*64)); }
+
+    //__________________________________________________________________
+    FrameCache::FrameCache():
+        m_corners(s_maxCornerCost)
+    {}
+
+    //__________________________________________________________________
+    FrameCache::~FrameCache()
+    { s_self = nullptr; }
+
+    //__________________________________________________________________
+    FrameCache *FrameCache::self()
+    {
+        if (!s_self)
+        { s_self = new FrameCache(); }
+
+        return s_self;
+    }
+
+    //__________________________________________________________________
+    QImage FrameCache::corners(const FrameKey &key)
+    {
+        if (const QImage *image = m_corners.object(key))
+            return *image;
+
+        const QImage image(createCorners(key));
+        if (!image.isNull())
+            m_corners.insert(key, new QImage(image), qMax<qsizetype>(1, image.sizeInBytes()));
+        return image;
+    }
+
+    //__________________________________________________________________
+    void FrameCache::paint(QPainter *painter, const QRectF &rect, const QMarginsF &borders, const FrameKey &key)
+    {
+        const QColor color(QColor::fromRgba(key.color));
+
+        // straight parts, as non overlapping solid rects
+        const QRectF inner(rect.marginsRemoved(borders));
+        const QRectF parts[] = {
+            QRectF(rect.left(), rect.top(), rect.width(), borders.top()),
+            QRectF(rect.left(), inner.bottom(), rect.width(), rect.bottom() - inner.bottom()),
+            QRectF(rect.left(), inner.top(), borders.left(), inner.height()),
+            QRectF(inner.right(), inner.top(), rect.right() - inner.right(), inner.height()) };
+
+        for (const QRectF &part : parts)
+        { if (part.isValid()) painter->fillRect(part, color); }
+
+        if (key.radius <= 0) return;
+
+        const QImage image(corners(key));
+        if (image.isNull()) return;
+
+        // corners replace what the straight parts painted below them
+        const qreal scale = image.devicePixelRatio();
+        const qreal cap = qMin({ image.width()/(2*scale), rect.width()/2, rect.height()/2 });
+        const qreal capPixels = cap*scale;
+        const qreal far = image.width() - capPixels;
+
+        painter->save();
+        painter->setCompositionMode(QPainter::CompositionMode_Source);
+        painter->drawImage(QRectF(rect.left(), rect.top(), cap, cap), image, QRectF(0, 0, capPixels, capPixels));
+        painter->drawImage(QRectF(rect.right() - cap, rect.top(), cap, cap), image, QRectF(far, 0, capPixels, capPixels));
+        painter->drawImage(QRectF(rect.left(), rect.bottom() - cap, cap, cap), image, QRectF(0, far, capPixels, capPixels));
+        painter->drawImage(QRectF(rect.right() - cap, rect.bottom() - cap, cap, cap), image, QRectF(far, far, capPixels, capPixels));
+        painter->restore();
+    }
+
+    //__________________________________________________________________
+    QImage FrameCache::createCorners(const FrameKey &key)
+    {
+        if (key.radius <= 0) return QImage();
+
+        // a rounded square just large enough for its four corners
+        const int capPixels = qCeil(key.radius*key.scale);
+        QImage image(2*capPixels, 2*capPixels, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(key.scale);
+        image.fill(Qt::transparent);
+
+        QPainter painter(&image);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(QColor::fromRgba(key.color));
+        painter.drawRoundedRect(QRectF(0, 0, image.width()/key.scale, image.height()/key.scale), key.radius, key.radius);
+        painter.end();
+
+        return image;
+    }
+
+}
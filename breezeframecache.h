@@ -0,0 +1,96 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QColor>
+#include <QImage>
+#include <QMarginsF>
+#include <QRectF>
+
+class QPainter;
+
+namespace Breeze
+{
+
+    //* everything the rounded frame corners depend on
+    struct FrameKey
+    {
+
+        //* corner radius, 0 for square corners
+        qreal radius = 0;
+
+        //* frame color, including alpha
+        QRgb color = 0;
+
+        //* device pixel ratio
+        qreal scale = 1;
+
+        bool operator == (const FrameKey &other) const
+        {
+            return radius == other.radius
+                && color == other.color
+                && scale == other.scale;
+        }
+
+    };
+
+    size_t qHash(const FrameKey &key, size_t seed = 0) noexcept;
+
+    //* nine-patch renderer for the window frame
+    /**
+    the four rounded corners are pre-rendered once per key. The straight parts are solid rects
+    limited to the border ring, so painting a frame costs the same for any window size.
+    */
+    class FrameCache
+    {
+
+        public:
+
+        //* destructor
+        ~FrameCache();
+
+        //* singleton
+        static FrameCache *self();
+
+        //* corners for given key, as one rounded square to be cut in four, rendered on demand
+        QImage corners(const FrameKey &key);
+
+        //* paint the ring between rect and rect minus borders, with rounded outer corners
+        void paint(QPainter *painter, const QRectF &rect, const QMarginsF &borders, const FrameKey &key);
+
+        private:
+
+        //* constructor
+        FrameCache();
+
+        //* rasterize corners
+        static QImage createCorners(const FrameKey &key);
+
+        //* corners, cost is their size in bytes
+        QCache<FrameKey, QImage> m_corners;
+
+        //* singleton
+        static FrameCache *s_self;
+
+    };
+
+}
@@ -66,6 +66,9 @@ namespace Breeze
         exceptions.readConfig( m_config );
         m_exceptions = exceptions.get();
 
+        // fonts are parsed again on demand
+        m_fonts.clear();
+
     }
 
     //__________________________________________________________________
@@ -128,4 +131,17 @@ namespace Breeze
 
     }
 
+    //__________________________________________________________________
+    TitleBarFontPtr SettingsProvider::titleBarFont(const InternalSettingsPtr &internalSettings) const
+    {
+        if (!internalSettings) return TitleBarFontPtr();
+
+        // decorations may be reconfigured before the provider, hence the check on the font description
+        TitleBarFontPtr &font = m_fonts[internalSettings.data()];
+        if (!font || font->description() != internalSettings->titleBarFont())
+        { font = TitleBarFontPtr(new TitleBarFont(internalSettings->titleBarFont())); }
+
+        return font;
+    }
+
 }
@@ -24,9 +24,11 @@
 #include "breeze.h"
 #include "breezedecoration.h"
 #include "breezesettings.h"
+#include "breezetitlebarfont.h"
 
 #include <KSharedConfig>
 
+#include <QHash>
 #include <QObject>
 
 namespace Breeze
@@ -48,6 +50,9 @@ namespace Breeze
         //* internal settings for given decoration
         InternalSettingsPtr internalSettings(Decoration *) const;
 
+        //* title bar font for given internal settings, parsed once per reconfiguration
+        TitleBarFontPtr titleBarFont(const InternalSettingsPtr &) const;
+
         public Q_SLOTS:
 
         //* reconfigure
@@ -64,6 +69,9 @@ namespace Breeze
         //* exceptions
         InternalSettingsList m_exceptions;
 
+        //* parsed title bar fonts, per internal settings
+        mutable QHash<const InternalSettings*, TitleBarFontPtr> m_fonts;
+
         //* config object
         KSharedConfigPtr m_config;
 
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezeshadowcache.h"
+#include "breeze.h"
+
+#include "breezeboxshadowrenderer.h"
+
+#include <QHashFunctions>
+#include <QPainter>
+
+namespace
+{
+    struct ShadowParams {
+        ShadowParams()
+            : offset(QPoint(0, 0))
+            , radius(0)
+            , opacity(0) {}
+
+        ShadowParams(const QPoint &offset, int radius, qreal opacity)
+            : offset(offset)
+            , radius(radius)
+            , opacity(opacity) {}
+
+        QPoint offset;
+        int radius;
+        qreal opacity;
+    };
+
+    struct CompositeShadowParams {
+        CompositeShadowParams() = default;
+
+        CompositeShadowParams(
+                const QPoint &offset,
+                const ShadowParams &shadow1,
+                const ShadowParams &shadow2)
+            : offset(offset)
+            , shadow1(shadow1)
+            , shadow2(shadow2) {}
+
+        bool isNone() const {
+            return qMax(shadow1.radius, shadow2.radius) == 0;
+        }
+
+        QPoint offset;
+        ShadowParams shadow1;
+        ShadowParams shadow2;
+    };
+
+    const CompositeShadowParams s_shadowParams[] = {
+        // None
+        CompositeShadowParams(),
+        // Small
+        CompositeShadowParams(
+            QPoint(0, 4),
+            ShadowParams(QPoint(0, 0), 16, 1),
+            ShadowParams(QPoint(0, -2), 8, 0.4)),
+        // Medium
+        CompositeShadowParams(
+            QPoint(0, 8),
+            ShadowParams(QPoint(0, 0), 32, 0.9),
+            ShadowParams(QPoint(0, -4), 16, 0.3)),
+        // Large
+        CompositeShadowParams(
+            QPoint(0, 12),
+            ShadowParams(QPoint(0, 0), 48, 0.8),
+            ShadowParams(QPoint(0, -6), 24, 0.2)),
+        // Very large
+        CompositeShadowParams(
+            QPoint(0, 16),
+            ShadowParams(QPoint(0, 0), 64, 0.7),
+            ShadowParams(QPoint(0, -8), 32, 0.1)),
+    };
+
+    inline CompositeShadowParams lookupShadowParams(int size)
+    {
+        switch (size) {
+        case Breeze::InternalSettings::ShadowNone:
+            return s_shadowParams[0];
+        case Breeze::InternalSettings::ShadowSmall:
+            return s_shadowParams[1];
+        case Breeze::InternalSettings::ShadowMedium:
+            return s_shadowParams[2];
+        case Breeze::InternalSettings::ShadowLarge:
+            return s_shadowParams[3];
+        case Breeze::InternalSettings::ShadowVeryLarge:
+            return s_shadowParams[4];
+        default:
+            // Fallback to the Large size.
+            return s_shadowParams[3];
+        }
+    }
+
+    //* color with given opacity
+    QColor withOpacity(const QColor &color, qreal opacity)
+    {
+        QColor c(color);
+        c.setAlphaF(opacity);
+        return c;
+    }
+}
+
+namespace Breeze
+{
+
+    ShadowCache *ShadowCache::s_self = nullptr;
+
+    //__________________________________________________________________
+    size_t qHash(const ShadowKey &key, size_t seed) noexcept
+    { return qHashMulti(seed, key.size, key.strength, key.color, qRound(key.radius*64), key.active); }
+
+    //__________________________________________________________________
+    ShadowCache::~ShadowCache()
+    { s_self = nullptr; }
+
+    //__________________________________________________________________
+    ShadowCache *ShadowCache::self()
+    {
+        if (!s_self)
+        { s_self = new ShadowCache(); }
+
+        return s_self;
+    }
+
+    //__________________________________________________________________
+    std::shared_ptr<KDecoration3::DecorationShadow> ShadowCache::shadow(const ShadowKey &key)
+    {
+        if (auto shadow = m_shadows.value(key).lock())
+            return shadow;
+
+        auto shadow = createShadow(key);
+        if (!shadow) return shadow;
+
+        // shadows no decoration uses anymore are dropped
+        for (auto it = m_shadows.begin(); it != m_shadows.end();)
+        { it = it->expired() ? m_shadows.erase(it) : std::next(it); }
+
+        m_shadows.insert(key, shadow);
+        return shadow;
+    }
+
+    //__________________________________________________________________
+    std::shared_ptr<KDecoration3::DecorationShadow> ShadowCache::createShadow(const ShadowKey &key)
+    {
+        const CompositeShadowParams params = lookupShadowParams(key.size);
+        if (params.isNone()) return nullptr;
+
+        const QColor color(QColor::fromRgba(key.color));
+        const QSize boxSize = BoxShadowRenderer::calculateMinimumBoxSize(params.shadow1.radius)
+            .expandedTo(BoxShadowRenderer::calculateMinimumBoxSize(params.shadow2.radius));
+
+        BoxShadowRenderer shadowRenderer;
+        shadowRenderer.setBorderRadius(key.radius + 0.5);
+        shadowRenderer.setBoxSize(boxSize);
+
+        const qreal strength = static_cast<qreal>(key.strength) / 255.0 * (key.active ? 1.0 : 0.5);
+        shadowRenderer.addShadow(params.shadow1.offset, params.shadow1.radius,
+            withOpacity(color, params.shadow1.opacity * strength));
+        shadowRenderer.addShadow(params.shadow2.offset, params.shadow2.radius,
+            withOpacity(color, params.shadow2.opacity * strength));
+
+        QImage shadowTexture = shadowRenderer.render();
+
+        QPainter painter(&shadowTexture);
+        painter.setRenderHint(QPainter::Antialiasing);
+
+        const QRectF outerRect = shadowTexture.rect();
+
+        QRectF boxRect(QPointF(0, 0), boxSize);
+        boxRect.moveCenter(outerRect.center());
+
+        // Mask out inner rect.
+        const QMarginsF padding = QMarginsF(
+            boxRect.left() - outerRect.left() - Metrics::Shadow_Overlap - params.offset.x(),
+            boxRect.top() - outerRect.top() - Metrics::Shadow_Overlap - params.offset.y(),
+            outerRect.right() - boxRect.right() - Metrics::Shadow_Overlap + params.offset.x(),
+            outerRect.bottom() - boxRect.bottom() - Metrics::Shadow_Overlap + params.offset.y());
+        const QRectF innerRect = outerRect - padding;
+        // Push the shadow slightly under the window, which helps avoiding glitches with fractional scaling
+        // TODO fix this more properly
+        //innerRect.adjust(2, 2, -2, -2);
+
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(Qt::black);
+        painter.setCompositionMode(QPainter::CompositionMode_DestinationOut);
+        painter.drawRoundedRect(
+            innerRect,
+            key.radius + 0.5,
+            key.radius + 0.5);
+
+        // Draw outline.
+        painter.setPen(withOpacity(color, 0.2 * strength));
+        painter.setBrush(Qt::NoBrush);
+        painter.setCompositionMode(QPainter::CompositionMode_SourceOver);
+        painter.drawRoundedRect(
+            innerRect,
+            key.radius - 0.5,
+            key.radius - 0.5);
+
+        painter.end();
+
+        auto shadow = std::make_shared<KDecoration3::DecorationShadow>();
+        shadow->setPadding(padding);
+        shadow->setInnerShadowRect(QRectF(outerRect.center(), QSizeF(1, 1)));
+        shadow->setShadow(shadowTexture);
+        return shadow;
+    }
+
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2014  Hugo Pereira Da Costa <hugo.pereira@free.fr>
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <KDecoration3/DecorationShadow>
+
+#include <QColor>
+#include <QHash>
+
+#include <memory>
+
+namespace Breeze
+{
+
+    //* everything a window shadow depends on
+    struct ShadowKey
+    {
+
+        //* InternalSettings::EnumShadowSize
+        int size = 0;
+
+        //* strength, in [0, 255]
+        int strength = 255;
+
+        //* shadow color
+        QRgb color = 0;
+
+        //* window corner radius, snapped to the pixel grid of the window scale
+        /** the texture is in logical pixels, so the scale only matters through this radius */
+        qreal radius = 0;
+
+        //* inactive windows have a lighter shadow
+        bool active = true;
+
+        bool operator == (const ShadowKey &other) const
+        {
+            return size == other.size
+                && strength == other.strength
+                && color == other.color
+                && radius == other.radius
+                && active == other.active;
+        }
+
+    };
+
+    size_t qHash(const ShadowKey &key, size_t seed = 0) noexcept;
+
+    //* window shadows, shared by all decorations with the same key
+    /**
+    the cache only holds weak references. A shadow is rendered when first requested,
+    and lives as long as some decoration holds on to it.
+    */
+    class ShadowCache
+    {
+
+        public:
+
+        //* destructor
+        ~ShadowCache();
+
+        //* singleton
+        static ShadowCache *self();
+
+        //* shadow for given key, rendered on demand. Null for ShadowNone
+        std::shared_ptr<KDecoration3::DecorationShadow> shadow(const ShadowKey &key);
+
+        private:
+
+        //* constructor
+        ShadowCache() = default;
+
+        //* render shadow
+        static std::shared_ptr<KDecoration3::DecorationShadow> createShadow(const ShadowKey &key);
+
+        //* shadows
+        QHash<ShadowKey, std::weak_ptr<KDecoration3::DecorationShadow>> m_shadows;
+
+        //* singleton
+        static ShadowCache *s_self;
+
+    };
+
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezetitlebarcache.h"
+
+#include <QHashFunctions>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QtMath>
+
+namespace Breeze
+{
+
+    //* upper bound for the memory used by textures (bytes)
+    static constexpr int s_maxTextureCost = 4*1024*1024;
+
+    TitleBarCache *TitleBarCache::s_self = nullptr;
+
+    //__________________________________________________________________
+    size_t qHash(const TitleBarKey &key, size_t seed) noexcept
+    {
+        return qHashMulti(seed,
+                          qRound(key.height*64), key.color, key.gradient, key.intensity,
+                          qRound(key.radius*64), int(key.edges), qRound(key.scale*64));
+    }
+
+    //__________________________________________________________________
+    TitleBarCache::TitleBarCache():
+        m_textures(s_maxTextureCost)
+    {}
+
+    //__________________________________________________________________
+    TitleBarCache::~TitleBarCache()
+    { s_self = nullptr; }
+
+    //__________________________________________________________________
+    TitleBarCache *TitleBarCache::self()
+    {
+        if (!s_self)
+        { s_self = new TitleBarCache(); }
+
+        return s_self;
+    }
+
+    //__________________________________________________________________
+    TitleBarTexture TitleBarCache::texture(const TitleBarKey &key)
+    {
+        if (const TitleBarTexture *texture = m_textures.object(key))
+            return *texture;
+
+        const TitleBarTexture texture(createTexture(key));
+        const qsizetype cost = texture.left.sizeInBytes() + texture.strip.sizeInBytes() + texture.right.sizeInBytes();
+        m_textures.insert(key, new TitleBarTexture(texture), qMax<qsizetype>(1, cost));
+        return texture;
+    }
+
+    //__________________________________________________________________
+    void TitleBarCache::paint(QPainter *painter, const QRectF &rect, const TitleBarTexture &texture)
+    {
+        if (texture.strip.isNull()) return;
+
+        // corner caps, shrunk on both sides for title bars narrower than two caps
+        const qreal scale = texture.strip.devicePixelRatio();
+        const qreal capWidth = qMin<qreal>(texture.left.width()/scale, rect.width()/2);
+        if (capWidth > 0)
+        {
+            painter->drawImage(QRectF(rect.left(), rect.top(), capWidth, rect.height()), texture.left,
+                               QRectF(0, 0, capWidth*scale, texture.left.height()));
+
+            painter->drawImage(QRectF(rect.right() - capWidth, rect.top(), capWidth, rect.height()), texture.right,
+                               QRectF(texture.right.width() - capWidth*scale, 0, capWidth*scale, texture.right.height()));
+        }
+
+        // stretched strip in between
+        const qreal stripWidth = rect.width() - 2*capWidth;
+        if (stripWidth > 0)
+        {
+            painter->drawImage(QRectF(rect.left() + capWidth, rect.top(), stripWidth, rect.height()), texture.strip,
+                               QRectF(0, 0, 1, texture.strip.height()));
+        }
+    }
+
+    //__________________________________________________________________
+    TitleBarTexture TitleBarCache::createTexture(const TitleBarKey &key)
+    {
+        TitleBarTexture texture;
+        if (key.height <= 0) return texture;
+
+        /*
+         * render a title bar just wide enough for its two corners and one pixel in between,
+         * then cut it into caps and strip. Away from the corners, every column is the same.
+         */
+        const int capPixels = qCeil(key.radius*key.scale);
+        const int heightPixels = qCeil(key.height*key.scale);
+        QImage image(2*capPixels + 1, heightPixels, QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(key.scale);
+        image.fill(Qt::transparent);
+
+        const QRectF titleRect(0, 0, image.width()/key.scale, key.height);
+        const QColor titleBarColor(QColor::fromRgba(key.color));
+
+        // linear gradient with a light border at the top
+        QLinearGradient gradient(0, 0, 0, titleRect.height());
+        const QColor lightCol(titleBarColor.lighter(130 + key.intensity));
+        gradient.setColorAt(0.0, lightCol);
+        gradient.setColorAt(0.99 / titleRect.height(), lightCol);
+        if (key.gradient) gradient.setColorAt(1.0 / titleRect.height(), titleBarColor.lighter(100 + key.intensity));
+        else gradient.setColorAt(1.0 / titleRect.height(), titleBarColor);
+        gradient.setColorAt(1.0, titleBarColor);
+
+        QPainter painter(&image);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(gradient);
+
+        // sides in edges are made larger, to clip away their rounded corners
+        const qreal radius = key.radius;
+        painter.drawRoundedRect(titleRect.adjusted(key.edges & Qt::LeftEdge ? -radius : 0,
+                                                   key.edges & Qt::TopEdge ? -radius : 0,
+                                                   key.edges & Qt::RightEdge ? radius : 0,
+                                                   key.edges & Qt::BottomEdge ? radius : 0),
+                                radius, radius);
+        painter.end();
+
+        texture.left = image.copy(0, 0, capPixels, heightPixels);
+        texture.strip = image.copy(capPixels, 0, 1, heightPixels);
+        texture.right = image.copy(capPixels + 1, 0, capPixels, heightPixels);
+        return texture;
+    }
+
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QColor>
+#include <QImage>
+#include <QRectF>
+
+class QPainter;
+
+namespace Breeze
+{
+
+    //* everything the title bar background depends on
+    struct TitleBarKey
+    {
+
+        //* title bar height, in logical pixels
+        qreal height = 0;
+
+        //* title bar color, including alpha
+        QRgb color = 0;
+
+        //* true for the gradient of the drawBackgroundGradient option, false for the flat look
+        bool gradient = false;
+
+        //* backgroundGradientIntensity, when gradient is set
+        int intensity = 0;
+
+        //* corner radius, 0 for square corners
+        qreal radius = 0;
+
+        //* sides whose corners are pushed outside of the title bar, i.e. not rounded
+        Qt::Edges edges;
+
+        //* device pixel ratio
+        qreal scale = 1;
+
+        bool operator == (const TitleBarKey &other) const
+        {
+            return height == other.height
+                && color == other.color
+                && gradient == other.gradient
+                && intensity == other.intensity
+                && radius == other.radius
+                && edges == other.edges
+                && scale == other.scale;
+        }
+
+    };
+
+    size_t qHash(const TitleBarKey &key, size_t seed = 0) noexcept;
+
+    //* pre-rendered title bar background
+    /**
+    the background is uniform horizontally but for its corners. It is stored as a one pixel wide
+    strip and two corner caps, so that any width is composed with three blits.
+    */
+    struct TitleBarTexture
+    {
+        QImage left;
+        QImage strip;
+        QImage right;
+    };
+
+    //* process-wide cache of title bar backgrounds, shared by all decorations
+    class TitleBarCache
+    {
+
+        public:
+
+        //* destructor
+        ~TitleBarCache();
+
+        //* singleton
+        static TitleBarCache *self();
+
+        //* texture for given key, rendered on demand
+        TitleBarTexture texture(const TitleBarKey &key);
+
+        //* compose texture over given rect
+        static void paint(QPainter *painter, const QRectF &rect, const TitleBarTexture &texture);
+
+        private:
+
+        //* constructor
+        TitleBarCache();
+
+        //* rasterize a texture
+        static TitleBarTexture createTexture(const TitleBarKey &key);
+
+        //* textures, cost is their size in bytes
+        QCache<TitleBarKey, TitleBarTexture> m_textures;
+
+        //* singleton
+        static TitleBarCache *s_self;
+
+    };
+
+}
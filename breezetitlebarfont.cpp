@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "breezetitlebarfont.h"
+
+#include <QFontDatabase>
+
+namespace Breeze
+{
+
+    //__________________________________________________________________
+    static QFont parseFont(const QString &description)
+    {
+        QFont font;
+        font.fromString(description);
+        return font;
+    }
+
+    //__________________________________________________________________
+    TitleBarFont::TitleBarFont(const QString &description):
+        m_description(description),
+        m_font(parseFont(description)),
+        m_paintFont(m_font),
+        m_metrics(m_font),
+        m_height(m_metrics.height()),
+        m_styleName(QFontDatabase::styleString(m_font))
+    {
+        // KDE needs this FIXME: Why?
+        m_paintFont.setStyleName(m_styleName);
+    }
+
+}
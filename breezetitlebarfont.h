@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026  agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of
+ * the License or (at your option) version 3 or any later version
+ * accepted by the membership of KDE e.V. (or its successor approved
+ * by the membership of KDE e.V.), which shall act as a proxy
+ * defined in Section 14 of version 3 of the license.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QFont>
+#include <QFontMetricsF>
+#include <QSharedPointer>
+#include <QString>
+
+namespace Breeze
+{
+
+    //* title bar font of one InternalSettings, parsed once and shared by all decorations using them
+    class TitleBarFont
+    {
+
+        public:
+
+        //* constructor, from the titleBarFont setting
+        explicit TitleBarFont(const QString &description);
+
+        //* the titleBarFont setting this was parsed from
+        const QString &description() const
+        { return m_description; }
+
+        //* font, for metrics
+        const QFont &font() const
+        { return m_font; }
+
+        //* font with its style name set, for painting
+        const QFont &paintFont() const
+        { return m_paintFont; }
+
+        //* metrics
+        const QFontMetricsF &metrics() const
+        { return m_metrics; }
+
+        //* line height
+        qreal height() const
+        { return m_height; }
+
+        //* style name
+        const QString &styleName() const
+        { return m_styleName; }
+
+        private:
+
+        QString m_description;
+        QFont m_font;
+        QFont m_paintFont;
+        QFontMetricsF m_metrics;
+        qreal m_height = 0;
+        QString m_styleName;
+
+    };
+
+    using TitleBarFontPtr = QSharedPointer<const TitleBarFont>;
+
+}
@@ -0,0 +1,427 @@
+/*
+ * Copyright (C) 2018 Vlad Zagorodniy <vladzzag@gmail.com>
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+// own
+#include "breezeboxblur_p.h"
+
+// Qt
+#include <QtGlobal>
+
+// C++
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Breeze
+{
+namespace
+{
+/**
+ * One lane at a time.
+ **/
+struct ScalarLanes {
+    using Sum = uint32_t;
+
+    static Sum splat(uint32_t value)
+    {
+        return value;
+    }
+
+    static Sum load(const uint8_t *src)
+    {
+        return *src;
+    }
+
+    static Sum add(Sum a, Sum b)
+    {
+        return a + b;
+    }
+
+    static Sum sub(Sum a, Sum b)
+    {
+        return a - b;
+    }
+
+    static void store(uint8_t *dst, Sum sum, uint32_t reciprocal)
+    {
+        *dst = (sum * reciprocal) >> 24;
+    }
+};
+
+#if defined(__SSE2__)
+/**
+ * 16 lanes at a time, as four vectors of 32 bit sums.
+ **/
+struct SSE2Lanes {
+    static constexpr int size = 16;
+
+    struct Sum {
+        __m128i v[4];
+    };
+
+    static Sum splat(uint32_t value)
+    {
+        const __m128i v = _mm_set1_epi32(value);
+        return {{v, v, v, v}};
+    }
+
+    static Sum load(const uint8_t *src)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        return {{_mm_unpacklo_epi16(low, zero), _mm_unpackhi_epi16(low, zero), _mm_unpacklo_epi16(high, zero), _mm_unpackhi_epi16(high, zero)}};
+    }
+
+    static Sum add(const Sum &a, const Sum &b)
+    {
+        return {{_mm_add_epi32(a.v[0], b.v[0]), _mm_add_epi32(a.v[1], b.v[1]), _mm_add_epi32(a.v[2], b.v[2]), _mm_add_epi32(a.v[3], b.v[3])}};
+    }
+
+    static Sum sub(const Sum &a, const Sum &b)
+    {
+        return {{_mm_sub_epi32(a.v[0], b.v[0]), _mm_sub_epi32(a.v[1], b.v[1]), _mm_sub_epi32(a.v[2], b.v[2]), _mm_sub_epi32(a.v[3], b.v[3])}};
+    }
+
+    // (sum * reciprocal) >> 24. SSE2 has no 32 bit multiply, but the products fit in 32 bits
+    static __m128i scale(__m128i sum, __m128i reciprocal)
+    {
+        const __m128i even = _mm_srli_epi64(_mm_mul_epu32(sum, reciprocal), 24);
+        const __m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(sum, 32), reciprocal), 24);
+        return _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+    }
+
+    static void store(uint8_t *dst, const Sum &sum, uint32_t reciprocal)
+    {
+        const __m128i r = _mm_set1_epi32(reciprocal);
+        const __m128i low = _mm_packs_epi32(scale(sum.v[0], r), scale(sum.v[1], r));
+        const __m128i high = _mm_packs_epi32(scale(sum.v[2], r), scale(sum.v[3], r));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(low, high));
+    }
+};
+#endif
+
+static inline int calculateBlurRadius(double stdDev)
+{
+    // See https://www.w3.org/TR/SVG11/filters.html#feGaussianBlurElement
+    const double gaussianScaleFactor = (3.0 * std::sqrt(2.0 * M_PI) / 4.0) * 1.5;
+    return std::max(2, int(std::floor(stdDev * gaussianScaleFactor + 0.5)));
+}
+
+static inline double calculateBlurStdDev(int radius)
+{
+    // See https://www.w3.org/TR/css-backgrounds-3/#shadow-blur
+    return radius * 0.5;
+}
+
+/**
+ * Compute box filter parameters.
+ *
+ * @param radius The blur radius.
+ * @returns Parameters for three box filters.
+ **/
+std::array<BoxLobes, 3> computeLobes(int radius)
+{
+    const int blurRadius = calculateBlurRadius(calculateBlurStdDev(radius));
+    const int z = blurRadius / 3;
+
+    int major;
+    int minor;
+    int final;
+
+    switch (blurRadius % 3) {
+    case 0:
+        major = z;
+        minor = z;
+        final = z;
+        break;
+
+    case 1:
+        major = z + 1;
+        minor = z;
+        final = z;
+        break;
+
+    case 2:
+        major = z + 1;
+        minor = z;
+        final = z + 1;
+        break;
+
+    default:
+        Q_UNREACHABLE();
+        break;
+    }
+
+    Q_ASSERT(major + minor + final == blurRadius);
+
+    return {{{major, minor}, {minor, major}, {final, final}}};
+}
+
+/**
+ * Transpose bytes, one tile at a time so that both sides stay in cache.
+ *
+ * @param src The first input byte.
+ * @param srcPixelStride The number of bytes from one input byte to the next in a row.
+ * @param srcStride The number of bytes from one input row to the next.
+ * @param dst The first output byte.
+ * @param dstStride The number of bytes from one output row to the next.
+ * @param width The width of the input.
+ * @param height The height of the input.
+ **/
+template<int srcPixelStride>
+void transposeTiles(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int width, int height)
+{
+    const int tileSize = 32;
+    for (int y0 = 0; y0 < height; y0 += tileSize) {
+        const int y1 = std::min(y0 + tileSize, height);
+        for (int x0 = 0; x0 < width; x0 += tileSize) {
+            const int x1 = std::min(x0 + tileSize, width);
+            for (int y = y0; y < y1; ++y) {
+                const uint8_t *in = src + y * srcStride + x0 * srcPixelStride;
+                uint8_t *out = dst + x0 * dstStride + y;
+                for (int x = x0; x < x1; ++x, in += srcPixelStride, out += dstStride) {
+                    *out = *in;
+                }
+            }
+        }
+    }
+}
+
+#if defined(__SSE2__)
+/**
+ * Interleave rows i and i + 8 of a 16x16 block of bytes. Four rounds transpose the block.
+ **/
+static inline void interleaveRows(const __m128i *in, __m128i *out)
+{
+    out[0] = _mm_unpacklo_epi8(in[0], in[8]);
+    out[1] = _mm_unpackhi_epi8(in[0], in[8]);
+    out[2] = _mm_unpacklo_epi8(in[1], in[9]);
+    out[3] = _mm_unpackhi_epi8(in[1], in[9]);
+    out[4] = _mm_unpacklo_epi8(in[2], in[10]);
+    out[5] = _mm_unpackhi_epi8(in[2], in[10]);
+    out[6] = _mm_unpacklo_epi8(in[3], in[11]);
+    out[7] = _mm_unpackhi_epi8(in[3], in[11]);
+    out[8] = _mm_unpacklo_epi8(in[4], in[12]);
+    out[9] = _mm_unpackhi_epi8(in[4], in[12]);
+    out[10] = _mm_unpacklo_epi8(in[5], in[13]);
+    out[11] = _mm_unpackhi_epi8(in[5], in[13]);
+    out[12] = _mm_unpacklo_epi8(in[6], in[14]);
+    out[13] = _mm_unpackhi_epi8(in[6], in[14]);
+    out[14] = _mm_unpacklo_epi8(in[7], in[15]);
+    out[15] = _mm_unpackhi_epi8(in[7], in[15]);
+}
+
+/**
+ * Transpose single channel bytes, 16x16 at a time.
+ *
+ * The partial tiles at the right and bottom edges are left to the caller.
+ **/
+void transposeBlocksSSE2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int width, int height)
+{
+    __m128i a[16];
+    __m128i b[16];
+    for (int y0 = 0; y0 + 16 <= height; y0 += 16) {
+        for (int x0 = 0; x0 + 16 <= width; x0 += 16) {
+            const uint8_t *in = src + y0 * srcStride + x0;
+            for (int i = 0; i < 16; ++i, in += srcStride) {
+                a[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+            }
+
+            interleaveRows(a, b);
+            interleaveRows(b, a);
+            interleaveRows(a, b);
+            interleaveRows(b, a);
+
+            uint8_t *out = dst + x0 * dstStride + y0;
+            for (int i = 0; i < 16; ++i, out += dstStride) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out), a[i]);
+            }
+        }
+    }
+}
+#endif
+
+void transposeTiles(const uint8_t *src, int srcPixelStride, int srcStride, uint8_t *dst, int dstStride, int width, int height)
+{
+    switch (srcPixelStride) {
+    case 1: {
+#if defined(__SSE2__)
+        // whole blocks with vectors, then the right and bottom edges
+        transposeBlocksSSE2(src, srcStride, dst, dstStride, width, height);
+        const int blockWidth = width & ~15;
+        const int blockHeight = height & ~15;
+        transposeTiles<1>(src + blockWidth, srcStride, dst + blockWidth * dstStride, dstStride, width - blockWidth, blockHeight);
+        transposeTiles<1>(src + blockHeight * srcStride, srcStride, dst + blockHeight, dstStride, width, height - blockHeight);
+#else
+        transposeTiles<1>(src, srcStride, dst, dstStride, width, height);
+#endif
+        break;
+    }
+    case 4:
+        transposeTiles<4>(src, srcStride, dst, dstStride, width, height);
+        break;
+    default:
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                dst[x * dstStride + y] = src[y * srcStride + x * srcPixelStride];
+            }
+        }
+        break;
+    }
+}
+
+/**
+ * Blur columns of a plane with three box filters, in strips of adjacent lanes.
+ **/
+void boxBlurColumns(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int width, int height, const std::array<BoxLobes, 3> &lobes, BoxBlurKernel kernel)
+{
+    // the strip buffers stay in cache
+    const int stripWidth = 64;
+    std::vector<uint8_t> buf(2 * stripWidth * height);
+    uint8_t *buf1 = buf.data();
+    uint8_t *buf2 = buf1 + stripWidth * height;
+
+    for (int i = 0; i < width; i += stripWidth) {
+        const int lanes = std::min(stripWidth, width - i);
+        boxBlurLanes(src + i, srcStride, buf1, stripWidth, height, lanes, lobes[0], kernel);
+        boxBlurLanes(buf1, stripWidth, buf2, stripWidth, height, lanes, lobes[1], kernel);
+        boxBlurLanes(buf2, stripWidth, dst + i, dstStride, height, lanes, lobes[2], kernel);
+    }
+}
+
+BoxBlurKernel detectBoxBlurKernel()
+{
+#if defined(BREEZE_HAVE_AVX2_KERNEL)
+    if (__builtin_cpu_supports("avx2")) {
+        return BoxBlurKernel::AVX2;
+    }
+#endif
+#if defined(__SSE2__)
+    return BoxBlurKernel::SSE2;
+#else
+    return BoxBlurKernel::Scalar;
+#endif
+}
+
+} // namespace
+
+#if defined(__SSE2__)
+int boxBlurLanesSSE2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int length, int lanes, const BoxLobes &lobes)
+{
+    int lane = 0;
+    for (; lane + SSE2Lanes::size <= lanes; lane += SSE2Lanes::size) {
+        boxBlurBlock<SSE2Lanes>(src + lane, srcStride, dst + lane, dstStride, length, lobes);
+    }
+    return lane;
+}
+#endif
+
+BoxBlurKernel bestBoxBlurKernel()
+{
+    static const BoxBlurKernel kernel = detectBoxBlurKernel();
+    return kernel;
+}
+
+void boxBlurLanes(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int length, int lanes, const BoxLobes &lobes, BoxBlurKernel kernel)
+{
+    if (length <= 0 || lanes <= 0) {
+        return;
+    }
+
+    if (kernel > bestBoxBlurKernel()) {
+        kernel = bestBoxBlurKernel();
+    }
+
+    // widest vectors first, what is left over is done one lane at a time
+    int lane = 0;
+#if defined(BREEZE_HAVE_AVX2_KERNEL)
+    if (kernel == BoxBlurKernel::AVX2) {
+        lane += boxBlurLanesAVX2(src, srcStride, dst, dstStride, length, lanes, lobes);
+    }
+#endif
+#if defined(__SSE2__)
+    if (kernel >= BoxBlurKernel::SSE2) {
+        lane += boxBlurLanesSSE2(src + lane, srcStride, dst + lane, dstStride, length, lanes - lane, lobes);
+    }
+#endif
+
+    for (; lane < lanes; ++lane) {
+        boxBlurBlock<ScalarLanes>(src + lane, srcStride, dst + lane, dstStride, length, lobes);
+    }
+}
+
+
+int boxBlurExtent(int radius)
+{
+    return calculateBlurRadius(calculateBlurStdDev(radius));
+}
+
+double boxBlurStdDev(int radius)
+{
+    // a box of n pixels has a variance of (n^2 - 1) / 12, and variances add up
+    double variance = 0;
+    for (const BoxLobes &lobes : computeLobes(radius)) {
+        const int boxSize = lobes.left + 1 + lobes.right;
+        variance += (boxSize * boxSize - 1) / 12.0;
+    }
+
+    return std::sqrt(variance);
+}
+
+void boxBlurAlpha(uint8_t *alpha, int pixelStride, int bytesPerLine, int width, int height, int radius, BoxBlurKernel kernel)
+{
+    if (radius < 2 || width <= 0 || height <= 0) {
+        return;
+    }
+
+    const std::array<BoxLobes, 3> lobes = computeLobes(radius);
+
+    // Rows of the image are columns of the transposed plane.
+    std::vector<uint8_t> transposed(width * height);
+    std::vector<uint8_t> plane(width * height);
+
+    // Blur the image in horizontal direction.
+    transposeTiles(alpha, pixelStride, bytesPerLine, transposed.data(), height, width, height);
+    boxBlurColumns(transposed.data(), height, transposed.data(), height, height, width, lobes, kernel);
+    transposeTiles(transposed.data(), 1, height, plane.data(), width, height, width);
+
+    // Blur the image in vertical direction. Single channel images are written to directly.
+    if (pixelStride == 1) {
+        boxBlurColumns(plane.data(), width, alpha, bytesPerLine, width, height, lobes, kernel);
+        return;
+    }
+
+    boxBlurColumns(plane.data(), width, plane.data(), width, width, height, lobes, kernel);
+    for (int i = 0; i < height; ++i) {
+        const uint8_t *in = plane.data() + i * width;
+        uint8_t *out = alpha + i * bytesPerLine;
+        for (int j = 0; j < width; ++j, out += pixelStride) {
+            *out = in[j];
+        }
+    }
+}
+
+} // namespace Breeze
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2018 Vlad Zagorodniy <vladzzag@gmail.com>
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+// own
+#include "breezecommon_export.h"
+
+// C++
+#include <cstdint>
+
+namespace Breeze
+{
+/**
+ * Parameters of a box filter.
+ **/
+struct BoxLobes {
+    int left; ///< how many pixels sample to the left
+    int right; ///< how many pixels sample to the right
+};
+
+/**
+ * Box blur kernels, in increasing order of speed.
+ **/
+enum class BoxBlurKernel {
+    Scalar,
+    SSE2,
+    AVX2,
+};
+
+/**
+ * The fastest kernel supported by the CPU.
+ **/
+BREEZECOMMON_EXPORT BoxBlurKernel bestBoxBlurKernel();
+
+/**
+ * Blur lanes of bytes with a box filter.
+ *
+ * Each of the @p lanes adjacent bytes is filtered independently, along @p length steps.
+ * Edges are extended with the first and last value of each lane. Results are
+ * the same for all kernels.
+ *
+ * @param src The first step of the input lanes.
+ * @param srcStride The number of bytes from one input step to the next.
+ * @param dst The first step of the output lanes. It must not overlap the input.
+ * @param dstStride The number of bytes from one output step to the next.
+ * @param length The number of steps.
+ * @param lanes The number of lanes.
+ * @param lobes Params of the box filter.
+ * @param kernel The kernel to use. Falls back to slower kernels if not supported.
+ **/
+BREEZECOMMON_EXPORT void boxBlurLanes(const uint8_t *src,
+                                      int srcStride,
+                                      uint8_t *dst,
+                                      int dstStride,
+                                      int length,
+                                      int lanes,
+                                      const BoxLobes &lobes,
+                                      BoxBlurKernel kernel = bestBoxBlurKernel());
+
+/**
+ * How far a blur reaches, in pixels.
+ *
+ * @param radius The blur radius.
+ **/
+BREEZECOMMON_EXPORT int boxBlurExtent(int radius);
+
+/**
+ * The standard deviation of the gaussian blur that boxBlurAlpha approximates, in pixels.
+ *
+ * @param radius The blur radius.
+ **/
+BREEZECOMMON_EXPORT double boxBlurStdDev(int radius);
+
+/**
+ * Blur an alpha channel with three box filters, approximating a gaussian blur.
+ *
+ * Both passes run on contiguous lanes: rows are transposed into a scratch buffer
+ * in cache sized tiles, blurred as columns, and transposed back.
+ *
+ * @param alpha The first alpha value.
+ * @param pixelStride The number of bytes from one alpha value to the next.
+ * @param bytesPerLine The number of bytes from one row to the next.
+ * @param width The width of the area to blur, in pixels.
+ * @param height The height of the area to blur, in pixels.
+ * @param radius The blur radius.
+ * @param kernel The kernel to use.
+ **/
+BREEZECOMMON_EXPORT void boxBlurAlpha(uint8_t *alpha,
+                                      int pixelStride,
+                                      int bytesPerLine,
+                                      int width,
+                                      int height,
+                                      int radius,
+                                      BoxBlurKernel kernel = bestBoxBlurKernel());
+
+} // namespace Breeze
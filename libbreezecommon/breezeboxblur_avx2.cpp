@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2018 Vlad Zagorodniy <vladzzag@gmail.com>
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+// This file is built with AVX2 enabled. It is only called if the CPU supports it.
+
+// own
+#include "breezeboxblur_p.h"
+
+// C++
+#include <immintrin.h>
+
+namespace Breeze
+{
+namespace
+{
+/**
+ * 32 lanes at a time, as four vectors of 32 bit sums.
+ **/
+struct AVX2Lanes {
+    static constexpr int size = 32;
+
+    struct Sum {
+        __m256i v[4];
+    };
+
+    static Sum splat(uint32_t value)
+    {
+        const __m256i v = _mm256_set1_epi32(value);
+        return {{v, v, v, v}};
+    }
+
+    static Sum load(const uint8_t *src)
+    {
+        return {{_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src))),
+                 _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + 8))),
+                 _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + 16))),
+                 _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + 24)))}};
+    }
+
+    static Sum add(const Sum &a, const Sum &b)
+    {
+        return {{_mm256_add_epi32(a.v[0], b.v[0]), _mm256_add_epi32(a.v[1], b.v[1]), _mm256_add_epi32(a.v[2], b.v[2]), _mm256_add_epi32(a.v[3], b.v[3])}};
+    }
+
+    static Sum sub(const Sum &a, const Sum &b)
+    {
+        return {{_mm256_sub_epi32(a.v[0], b.v[0]), _mm256_sub_epi32(a.v[1], b.v[1]), _mm256_sub_epi32(a.v[2], b.v[2]), _mm256_sub_epi32(a.v[3], b.v[3])}};
+    }
+
+    static void store(uint8_t *dst, const Sum &sum, uint32_t reciprocal)
+    {
+        const __m256i r = _mm256_set1_epi32(reciprocal);
+        const __m256i s0 = _mm256_srli_epi32(_mm256_mullo_epi32(sum.v[0], r), 24);
+        const __m256i s1 = _mm256_srli_epi32(_mm256_mullo_epi32(sum.v[1], r), 24);
+        const __m256i s2 = _mm256_srli_epi32(_mm256_mullo_epi32(sum.v[2], r), 24);
+        const __m256i s3 = _mm256_srli_epi32(_mm256_mullo_epi32(sum.v[3], r), 24);
+
+        // packing works within 128 bit halves, put the lanes back in order
+        const __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(s0, s1), _mm256_packs_epi32(s2, s3));
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_permutevar8x32_epi32(bytes, order));
+    }
+};
+
+} // namespace
+
+int boxBlurLanesAVX2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int length, int lanes, const BoxLobes &lobes)
+{
+    int lane = 0;
+    for (; lane + AVX2Lanes::size <= lanes; lane += AVX2Lanes::size) {
+        boxBlurBlock<AVX2Lanes>(src + lane, srcStride, dst + lane, dstStride, length, lobes);
+    }
+    return lane;
+}
+
+} // namespace Breeze
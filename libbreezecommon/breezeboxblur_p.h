@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2018 Vlad Zagorodniy <vladzzag@gmail.com>
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#pragma once
+
+// own
+#include "breezeboxblur.h"
+
+namespace Breeze
+{
+namespace
+{
+/**
+ * Filter a block of lanes with a box filter.
+ *
+ * This is the sliding window of the original scalar kernel, written once for all
+ * vector widths. @p Lanes provides the vector type and its operations. Sums are
+ * kept in 32 bits so results are the same for all of them.
+ **/
+template<typename Lanes>
+inline void boxBlurBlock(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int length, const BoxLobes &lobes)
+{
+    using Sum = typename Lanes::Sum;
+
+    const int boxSize = lobes.left + 1 + lobes.right;
+    const uint32_t reciprocal = (1u << 24) / boxSize;
+
+    const Sum firstValue = Lanes::load(src);
+    const Sum lastValue = Lanes::load(src + (length - 1) * srcStride);
+
+    Sum alphaSum = Lanes::splat((boxSize + 1) / 2);
+    for (int i = 0; i < lobes.left; ++i) {
+        alphaSum = Lanes::add(alphaSum, firstValue);
+    }
+
+    // lanes shorter than the box read their last value past the end
+    const uint8_t *right = src;
+    int index = 0;
+    for (; index < boxSize - lobes.left; ++index) {
+        alphaSum = Lanes::add(alphaSum, index < length ? Lanes::load(right) : lastValue);
+        if (index < length - 1) {
+            right += srcStride;
+        }
+    }
+
+    uint8_t *out = dst;
+    uint8_t *const end = dst + length * dstStride;
+    for (; index < boxSize && out != end; ++index, out += dstStride) {
+        Lanes::store(out, alphaSum, reciprocal);
+        alphaSum = Lanes::sub(Lanes::add(alphaSum, index < length ? Lanes::load(right) : lastValue), firstValue);
+        if (index < length - 1) {
+            right += srcStride;
+        }
+    }
+
+    const uint8_t *left = src;
+    for (; index < length; ++index, out += dstStride, left += srcStride, right += srcStride) {
+        Lanes::store(out, alphaSum, reciprocal);
+        alphaSum = Lanes::sub(Lanes::add(alphaSum, Lanes::load(right)), Lanes::load(left));
+    }
+
+    for (; out != end; out += dstStride, left += srcStride) {
+        Lanes::store(out, alphaSum, reciprocal);
+        alphaSum = Lanes::sub(Lanes::add(alphaSum, lastValue), Lanes::load(left));
+    }
+}
+
+} // namespace
+
+/**
+ * Vector kernels, each one in a translation unit built for its instruction set.
+ * They process as many whole vectors as fit in @p lanes, and return how many lanes they did.
+ **/
+int boxBlurLanesSSE2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int length, int lanes, const BoxLobes &lobes);
+int boxBlurLanesAVX2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride, int length, int lanes, const BoxLobes &lobes);
+
+} // namespace Breeze
@@ -20,265 +20,353 @@
 
 // own
 #include "breezeboxshadowrenderer.h"
+#include "breezeboxblur.h"
 
 // Qt
+#include <QCache>
+#include <QHashFunctions>
 #include <QPainter>
+#include <QSemaphore>
+#include <QThreadPool>
 #include <QtMath>
 
+// C++
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace Breeze
 {
-static inline int calculateBlurRadius(qreal stdDev)
+static inline QSize calculateBlurExtent(int radius)
 {
-    // See https://www.w3.org/TR/SVG11/filters.html#feGaussianBlurElement
-    const qreal gaussianScaleFactor = (3.0 * qSqrt(2.0 * M_PI) / 4.0) * 1.5;
-    return qMax(2, qFloor(stdDev * gaussianScaleFactor + 0.5));
+    const int blurRadius = boxBlurExtent(radius);
+    return QSize(blurRadius, blurRadius);
 }
 
-static inline qreal calculateBlurStdDev(int radius)
+static inline void mirrorTopLeftQuadrant(QImage &mask)
 {
-    // See https://www.w3.org/TR/css-backgrounds-3/#shadow-blur
-    return radius * 0.5;
-}
+    const int width = mask.width();
+    const int height = mask.height();
 
-static inline QSize calculateBlurExtent(int radius)
-{
-    const int blurRadius = calculateBlurRadius(calculateBlurStdDev(radius));
-    return QSize(blurRadius, blurRadius);
-}
+    const int centerX = qCeil(width * 0.5);
+    const int centerY = qCeil(height * 0.5);
 
-struct BoxLobes {
-    int left; ///< how many pixels sample to the left
-    int right; ///< how many pixels sample to the right
-};
+    for (int y = 0; y < centerY; ++y) {
+        uint8_t *row = mask.scanLine(y);
+        for (int x = 0; x < centerX; ++x) {
+            row[width - x - 1] = row[x];
+        }
+    }
 
+    // the middle row of an odd height is its own mirror
+    for (int y = 0; y < height / 2; ++y) {
+        std::memcpy(mask.scanLine(height - y - 1), mask.constScanLine(y), width);
+    }
+}
+
+namespace
+{
 /**
- * Compute box filter parameters.
- *
- * @param radius The blur radius.
- * @returns Parameters for three box filters.
+ * Everything a blurred shadow mask depends on. The offset of a shadow only moves
+ * the mask, so shadows that differ in offset or color share it.
  **/
-static QVector<BoxLobes> computeLobes(int radius)
-{
-    const int blurRadius = calculateBlurRadius(calculateBlurStdDev(radius));
-    const int z = blurRadius / 3;
-
-    int major;
-    int minor;
-    int final;
-
-    switch (blurRadius % 3) {
-    case 0:
-        major = z;
-        minor = z;
-        final = z;
-        break;
-
-    case 1:
-        major = z + 1;
-        minor = z;
-        final = z;
-        break;
-
-    case 2:
-        major = z + 1;
-        minor = z;
-        final = z + 1;
-        break;
-
-    default:
-        Q_UNREACHABLE();
-        break;
+struct ShadowMaskKey {
+    QSizeF boxSize;
+    qreal borderRadius;
+    double radius;
+    qreal scale;
+    BoxShadowRenderer::Generator generator;
+
+    bool operator==(const ShadowMaskKey &other) const
+    {
+        return boxSize == other.boxSize && borderRadius == other.borderRadius && radius == other.radius && scale == other.scale
+            && generator == other.generator;
     }
+};
+
+size_t qHash(const ShadowMaskKey &key, size_t seed = 0) noexcept
+{
+    return qHashMulti(seed,
+                      qRound(key.boxSize.width() * 64),
+                      qRound(key.boxSize.height() * 64),
+                      qRound(key.borderRadius * 64),
+                      qRound(key.radius * 64),
+                      qRound(key.scale * 64),
+                      int(key.generator));
+}
+} // namespace
 
-    Q_ASSERT(major + minor + final == blurRadius);
+// Blurred masks, in bytes. Enough for both layers of every shadow size at a few scales.
+static const int s_maskCacheCost = 16 * 1024 * 1024;
 
-    return {{major, minor}, {minor, major}, {final, final}};
+static QCache<ShadowMaskKey, QImage> &maskCache()
+{
+    static QCache<ShadowMaskKey, QImage> cache(s_maskCacheCost);
+    return cache;
 }
 
 /**
- * Process a row with a box filter.
+ * Run a function over all rows, in chunks, on the calling thread and the global thread pool.
  *
- * @param src The start of the row.
- * @param dst The destination.
- * @param width The width of the row, in pixels.
- * @param horizontalStride The number of bytes from one alpha value to the
- *    next alpha value.
- * @param verticalStride The number of bytes from one row to the next row.
- * @param lobes Params of the box filter.
- * @param transposeInput Whether the input is transposed.
- * @param transposeOutput Whether the output should be transposed.
+ * @param rows The number of rows.
+ * @param function Called with the first and past the last row of each chunk.
  **/
-static inline void boxBlurRowAlpha(const uint8_t *src,
-                                   uint8_t *dst,
-                                   int width,
-                                   int horizontalStride,
-                                   int verticalStride,
-                                   const BoxLobes &lobes,
-                                   bool transposeInput,
-                                   bool transposeOutput)
+static void forEachRowChunk(int rows, const std::function<void(int, int)> &function)
 {
-    const int inputStep = transposeInput ? verticalStride : horizontalStride;
-    const int outputStep = transposeOutput ? verticalStride : horizontalStride;
-
-    const int boxSize = lobes.left + 1 + lobes.right;
-    const int reciprocal = (1 << 24) / boxSize;
-
-    uint32_t alphaSum = (boxSize + 1) / 2;
-
-    const uint8_t *left = src;
-    const uint8_t *right = src;
-    uint8_t *out = dst;
-
-    const uint8_t firstValue = src[0];
-    const uint8_t lastValue = src[(width - 1) * inputStep];
-
-    alphaSum += firstValue * lobes.left;
-
-    const uint8_t *initEnd = src + (boxSize - lobes.left) * inputStep;
-    while (right < initEnd) {
-        alphaSum += *right;
-        right += inputStep;
+    const int chunkRows = 16;
+    const int chunks = (rows + chunkRows - 1) / chunkRows;
+
+    std::atomic<int> nextChunk(0);
+    QSemaphore done;
+    const auto work = [&]() {
+        for (int chunk; (chunk = nextChunk++) < chunks;) {
+            function(chunk * chunkRows, qMin(rows, (chunk + 1) * chunkRows));
+        }
+    };
+
+    QThreadPool *pool = QThreadPool::globalInstance();
+    std::vector<std::unique_ptr<QRunnable>> workers;
+    for (int i = 1; i < qMin(chunks, pool->maxThreadCount()); ++i) {
+        workers.emplace_back(QRunnable::create([&]() {
+            work();
+            done.release();
+        }));
+        workers.back()->setAutoDelete(false);
+        pool->start(workers.back().get());
     }
 
-    const uint8_t *leftEnd = src + boxSize * inputStep;
-    while (right < leftEnd) {
-        *out = (alphaSum * reciprocal) >> 24;
-        alphaSum += *right - firstValue;
-        right += inputStep;
-        out += outputStep;
-    }
+    work();
 
-    const uint8_t *centerEnd = src + width * inputStep;
-    while (right < centerEnd) {
-        *out = (alphaSum * reciprocal) >> 24;
-        alphaSum += *right - *left;
-        left += inputStep;
-        right += inputStep;
-        out += outputStep;
+    // workers still queued would find nothing left to do, don't wait for the pool to get to them
+    for (const auto &worker : workers) {
+        if (pool->tryTake(worker.get())) {
+            done.release();
+        }
     }
 
-    const uint8_t *rightEnd = dst + width * outputStep;
-    while (out < rightEnd) {
-        *out = (alphaSum * reciprocal) >> 24;
-        alphaSum += lastValue - *left;
-        left += inputStep;
-        out += outputStep;
-    }
+    done.acquire(int(workers.size()));
 }
 
 /**
- * Blur the alpha channel of a given image.
+ * Compute the top-left quadrant of a gaussian blurred rounded rectangle.
+ *
+ * A rectangle blurs into the product of two differences of error functions, one per axis.
+ * Rounded corners only shorten the rows near the top and bottom edges, so these are cut
+ * into thin slices, each an exactly blurred rectangle, and the mask is a sum of separable
+ * terms: a horizontal profile per slice times its vertical weight in each row.
  *
- * @param image The input image.
- * @param radius The blur radius.
- * @param rect Specifies what part of the image to blur. If nothing is provided, then
- *    the whole alpha channel of the input image will be blurred.
+ * @param mask The mask.
+ * @param boxRect The rectangle, in pixels.
+ * @param xRadius The horizontal radius of the corners, in pixels.
+ * @param yRadius The vertical radius of the corners, in pixels.
+ * @param stdDev The standard deviation of the blur, in pixels.
  **/
-static inline void boxBlurAlpha(QImage &image, int radius, const QRect &rect = {})
+static void renderAnalyticQuadrant(QImage &mask, const QRectF &boxRect, qreal xRadius, qreal yRadius, double stdDev)
 {
-    if (radius < 2) {
-        return;
+    const int width = std::ceil(mask.width() * 0.5);
+    const int height = std::ceil(mask.height() * 0.5);
+
+    // gaussian mass of [a, b] seen from x
+    const double scale = 1.0 / (stdDev * M_SQRT2);
+    const auto mass = [scale](double a, double b, double x) {
+        return 0.5 * (std::erf((b - x) * scale) - std::erf((a - x) * scale));
+    };
+
+    double rx = qMin(xRadius, boxRect.width() * 0.5);
+    double ry = qMin(yRadius, boxRect.height() * 0.5);
+    if (rx <= 0 || ry <= 0) {
+        rx = 0;
+        ry = 0;
     }
 
-    const QVector<BoxLobes> lobes = computeLobes(radius);
-
-    const QRect blurRect = rect.isNull() ? image.rect() : rect;
-
-    const int alphaOffset = QSysInfo::ByteOrder == QSysInfo::BigEndian ? 0 : 3;
-    const int width = blurRect.width();
-    const int height = blurRect.height();
-    const int rowStride = image.bytesPerLine();
-    const int pixelStride = image.depth() >> 3;
-
-    const int bufferStride = qMax(width, height) * pixelStride;
-    QScopedPointer<uint8_t, QScopedPointerArrayDeleter<uint8_t>> buf(new uint8_t[2 * bufferStride]);
-    uint8_t *buf1 = buf.data();
-    uint8_t *buf2 = buf1 + bufferStride;
+    // corner slices of half a pixel
+    const int slices = std::ceil(2 * ry);
+    const double sliceHeight = slices ? ry / slices : 0;
 
-    // Blur the image in horizontal direction.
-    for (int i = 0; i < height; ++i) {
-        uint8_t *row = image.scanLine(blurRect.y() + i) + blurRect.x() * pixelStride + alphaOffset;
-        boxBlurRowAlpha(row, buf1, width, pixelStride, rowStride, lobes[0], false, false);
-        boxBlurRowAlpha(buf1, buf2, width, pixelStride, rowStride, lobes[1], false, false);
-        boxBlurRowAlpha(buf2, row, width, pixelStride, rowStride, lobes[2], false, false);
+    // horizontal profile of the straight part, then of each slice, from the top edge down
+    std::vector<float> profiles((slices + 1) * width);
+    for (int x = 0; x < width; ++x) {
+        profiles[x] = mass(boxRect.left(), boxRect.right(), x + 0.5);
     }
 
-    // Blur the image in vertical direction.
-    for (int i = 0; i < width; ++i) {
-        uint8_t *column = image.scanLine(blurRect.y()) + (blurRect.x() + i) * pixelStride + alphaOffset;
-        boxBlurRowAlpha(column, buf1, height, pixelStride, rowStride, lobes[0], true, false);
-        boxBlurRowAlpha(buf1, buf2, height, pixelStride, rowStride, lobes[1], false, false);
-        boxBlurRowAlpha(buf2, column, height, pixelStride, rowStride, lobes[2], false, true);
+    for (int slice = 0; slice < slices; ++slice) {
+        const double dy = 1.0 - (slice + 0.5) * sliceHeight / ry;
+        const double inset = rx * (1.0 - std::sqrt(1.0 - dy * dy));
+        float *profile = profiles.data() + (slice + 1) * width;
+        for (int x = 0; x < width; ++x) {
+            profile[x] = mass(boxRect.left() + inset, boxRect.right() - inset, x + 0.5);
+        }
     }
+
+    // scanLine() may detach, resolve the rows before going parallel
+    uint8_t *bits = mask.bits();
+    const qsizetype bytesPerLine = mask.bytesPerLine();
+
+    forEachRowChunk(height, [&](int first, int last) {
+        std::vector<float> weights(slices + 1);
+        std::vector<float> row(width);
+
+        for (int y = first; y < last; ++y) {
+            // vertical weights, slices at the bottom edge mirror the ones at the top
+            const double center = y + 0.5;
+            weights[0] = mass(boxRect.top() + ry, boxRect.bottom() - ry, center);
+            for (int slice = 0; slice < slices; ++slice) {
+                const double top = slice * sliceHeight;
+                const double bottom = top + sliceHeight;
+                weights[slice + 1] = mass(boxRect.top() + top, boxRect.top() + bottom, center)
+                    + mass(boxRect.bottom() - bottom, boxRect.bottom() - top, center);
+            }
+
+            std::fill(row.begin(), row.end(), 0.0f);
+            for (int slice = 0; slice <= slices; ++slice) {
+                const float weight = weights[slice];
+                const float *profile = profiles.data() + slice * width;
+                for (int x = 0; x < width; ++x) {
+                    row[x] += weight * profile[x];
+                }
+            }
+
+            uint8_t *out = bits + y * bytesPerLine;
+            for (int x = 0; x < width; ++x) {
+                out[x] = qBound(0, int(row[x] * 255.0f + 0.5f), 255);
+            }
+        }
+    });
 }
 
-static inline void mirrorTopLeftQuadrant(QImage &image)
+static QImage createMask(const ShadowMaskKey &key)
 {
-    const int width = image.width();
-    const int height = image.height();
+    const QSize inflation = calculateBlurExtent(key.radius);
+    const QSize pixelSize = ((key.boxSize + 2 * inflation) * key.scale).toSize();
+    const QSizeF size = QSizeF(pixelSize) / key.scale;
 
-    const int centerX = qCeil(width * 0.5);
-    const int centerY = qCeil(height * 0.5);
+    // Only the coverage carries information, so the shadow is rasterized, blurred
+    // and mirrored as a single channel mask and expanded to ARGB when tinting.
+    QImage mask(pixelSize, QImage::Format_Alpha8);
+    mask.setDevicePixelRatio(key.scale);
 
-    const int alphaOffset = QSysInfo::ByteOrder == QSysInfo::BigEndian ? 0 : 3;
-    const int stride = image.depth() >> 3;
+    QRectF boxRect(QPoint(0, 0), key.boxSize);
+    boxRect.moveCenter(QRectF(QPoint(0, 0), size).center());
 
-    for (int y = 0; y < centerY; ++y) {
-        uint8_t *in = image.scanLine(y) + alphaOffset;
-        uint8_t *out = in + (width - 1) * stride;
+    const qreal xRadius = 2.0 * key.borderRadius / boxRect.width();
+    const qreal yRadius = 2.0 * key.borderRadius / boxRect.height();
 
-        for (int x = 0; x < centerX; ++x, in += stride, out -= stride) {
-            *out = *in;
-        }
+    // Because the shadow texture is symmetrical, that's enough to blur
+    // only the top-left quadrant and then mirror it.
+    const int scaledRadius = std::round(key.radius * key.scale);
+    if (key.generator == BoxShadowRenderer::Generator::Analytic) {
+        const QRectF pixelBoxRect(boxRect.topLeft() * key.scale, boxRect.size() * key.scale);
+        renderAnalyticQuadrant(mask, pixelBoxRect, xRadius * key.scale, yRadius * key.scale, boxBlurStdDev(scaledRadius));
+    } else {
+        mask.fill(0);
+
+        QPainter maskPainter(&mask);
+        maskPainter.setRenderHint(QPainter::Antialiasing);
+        maskPainter.setPen(Qt::NoPen);
+        maskPainter.setBrush(Qt::black);
+        maskPainter.drawRoundedRect(boxRect, xRadius, yRadius);
+        maskPainter.end();
+
+        const QRect blurRect(0, 0, std::ceil(mask.width() * 0.5), std::ceil(mask.height() * 0.5));
+        boxBlurAlpha(mask.bits(), 1, mask.bytesPerLine(), blurRect.width(), blurRect.height(), scaledRadius);
     }
 
-    for (int y = 0; y < centerY; ++y) {
-        const uint8_t *in = image.scanLine(y) + alphaOffset;
-        uint8_t *out = image.scanLine(width - y - 1) + alphaOffset;
+    mirrorTopLeftQuadrant(mask);
 
-        for (int x = 0; x < width; ++x, in += stride, out += stride) {
-            *out = *in;
-        }
-    }
+    return mask;
 }
 
-static void renderShadow(QPainter *painter, const QRectF &rect, qreal borderRadius, const QPointF &offset, double radius, const QColor &color)
+static QImage blurredMask(const ShadowMaskKey &key)
 {
-    const qreal dpr = painter->device()->devicePixelRatioF();
-    const QSize inflation = calculateBlurExtent(radius);
-    const QSize pixelSize = ((rect.size() + 2 * inflation) * dpr).toSize();
-    const QSizeF size = QSizeF(pixelSize) / dpr;
+    QCache<ShadowMaskKey, QImage> &cache = maskCache();
+    if (const QImage *mask = cache.object(key)) {
+        return *mask;
+    }
 
-    QImage shadow(pixelSize, QImage::Format_ARGB32_Premultiplied);
-    shadow.setDevicePixelRatio(dpr);
-    shadow.fill(Qt::transparent);
+    const QImage mask = createMask(key);
+    cache.insert(key, new QImage(mask), qMax<qsizetype>(1, mask.sizeInBytes()));
+    return mask;
+}
 
-    QRectF boxRect(QPoint(0, 0), rect.size());
-    boxRect.moveCenter(QRectF(QPoint(0, 0), size).center());
+// Each channel of a premultiplied pixel times alpha / 255, rounded the way CompositionMode_SourceIn does.
+static inline QRgb multiplyPixel(QRgb pixel, uint alpha)
+{
+    uint t = (pixel & 0xff00ff) * alpha;
+    t = ((t + ((t >> 8) & 0xff00ff) + 0x800080) >> 8) & 0xff00ff;
+    uint x = ((pixel >> 8) & 0xff00ff) * alpha;
+    x = (x + ((x >> 8) & 0xff00ff) + 0x800080) & 0xff00ff00;
+    return x | t;
+}
 
-    const qreal xRadius = 2.0 * borderRadius / boxRect.width();
-    const qreal yRadius = 2.0 * borderRadius / boxRect.height();
+#if defined(__SSE2__)
+// Four pixels, from four alpha values each repeated twice in 16 bit lanes.
+static inline __m128i multiplyPixelsSSE2(__m128i alphaPairs, __m128i color)
+{
+    const __m128i half = _mm_set1_epi16(0x80);
+    __m128i low = _mm_mullo_epi16(_mm_unpacklo_epi32(alphaPairs, alphaPairs), color);
+    __m128i high = _mm_mullo_epi16(_mm_unpackhi_epi32(alphaPairs, alphaPairs), color);
+    low = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), half), 8);
+    high = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), half), 8);
+    return _mm_packus_epi16(low, high);
+}
+#endif
 
-    QPainter shadowPainter;
-    shadowPainter.begin(&shadow);
-    shadowPainter.setRenderHint(QPainter::Antialiasing);
-    shadowPainter.setPen(Qt::NoPen);
-    shadowPainter.setBrush(Qt::black);
-    shadowPainter.drawRoundedRect(boxRect, xRadius, yRadius);
-    shadowPainter.end();
+static QImage tintAlphaMask(const QImage &mask, const QColor &color)
+{
+    const QRgb premultiplied = qPremultiply(color.rgba());
+
+    QImage image(mask.size(), QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(mask.devicePixelRatio());
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i tint = _mm_unpacklo_epi8(_mm_set1_epi32(premultiplied), zero);
+#endif
+
+    const int width = mask.width();
+    for (int y = 0; y < mask.height(); ++y) {
+        const uint8_t *in = mask.constScanLine(y);
+        QRgb *out = reinterpret_cast<QRgb *>(image.scanLine(y));
+
+        int x = 0;
+#if defined(__SSE2__)
+        for (; x + 16 <= width; x += 16) {
+            const __m128i alpha = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + x));
+            const __m128i low = _mm_unpacklo_epi8(alpha, zero);
+            const __m128i high = _mm_unpackhi_epi8(alpha, zero);
+            __m128i *pixels = reinterpret_cast<__m128i *>(out + x);
+            _mm_storeu_si128(pixels, multiplyPixelsSSE2(_mm_unpacklo_epi16(low, low), tint));
+            _mm_storeu_si128(pixels + 1, multiplyPixelsSSE2(_mm_unpackhi_epi16(low, low), tint));
+            _mm_storeu_si128(pixels + 2, multiplyPixelsSSE2(_mm_unpacklo_epi16(high, high), tint));
+            _mm_storeu_si128(pixels + 3, multiplyPixelsSSE2(_mm_unpackhi_epi16(high, high), tint));
+        }
+#endif
+        for (; x < width; ++x) {
+            out[x] = multiplyPixel(premultiplied, in[x]);
+        }
+    }
 
-    // Because the shadow texture is symmetrical, that's enough to blur
-    // only the top-left quadrant and then mirror it.
-    const QRect blurRect(0, 0, std::ceil(shadow.width() * 0.5), std::ceil(shadow.height() * 0.5));
-    const int scaledRadius = std::round(radius * dpr);
-    boxBlurAlpha(shadow, scaledRadius, blurRect);
-    mirrorTopLeftQuadrant(shadow);
+    return image;
+}
 
-    // Give the shadow a tint of the desired color.
-    shadowPainter.begin(&shadow);
-    shadowPainter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-    shadowPainter.fillRect(shadow.rect(), color);
-    shadowPainter.end();
+static void renderShadow(QPainter *painter,
+                         BoxShadowRenderer::Generator generator,
+                         const QRectF &rect,
+                         qreal borderRadius,
+                         const QPointF &offset,
+                         double radius,
+                         const QColor &color)
+{
+    // The blur only depends on the geometry of the shadow. Changing its color or opacity,
+    // e.g. for inactive windows, is a single pass over a cached mask.
+    const qreal dpr = painter->device()->devicePixelRatioF();
+    const QImage shadow = tintAlphaMask(blurredMask({rect.size(), borderRadius, radius, dpr, generator}), color);
 
     // Actually, present the shadow.
     QRectF shadowRect = shadow.rect();
@@ -297,6 +385,16 @@ void BoxShadowRenderer::setBorderRadius(qreal radius)
     m_borderRadius = radius;
 }
 
+void BoxShadowRenderer::setGenerator(Generator generator)
+{
+    m_generator = generator;
+}
+
+BoxShadowRenderer::Generator BoxShadowRenderer::generator() const
+{
+    return m_generator;
+}
+
 void BoxShadowRenderer::addShadow(const QPointF &offset, double radius, const QColor &color)
 {
     Shadow shadow = {};
@@ -325,13 +423,18 @@ QImage BoxShadowRenderer::render() const
 
     QPainter painter(&canvas);
     for (const Shadow &shadow : std::as_const(m_shadows)) {
-        renderShadow(&painter, boxRect, m_borderRadius, shadow.offset, shadow.radius, shadow.color);
+        renderShadow(&painter, m_generator, boxRect, m_borderRadius, shadow.offset, shadow.radius, shadow.color);
     }
     painter.end();
 
     return canvas;
 }
 
+void BoxShadowRenderer::clearCache()
+{
+    maskCache().clear();
+}
+
 QSize BoxShadowRenderer::calculateMinimumBoxSize(int radius)
 {
     const QSize blurExtent = calculateBlurExtent(radius);
@@ -32,6 +32,14 @@ namespace Breeze
 class BREEZECOMMON_EXPORT BoxShadowRenderer
 {
 public:
+    /**
+     * How shadows are blurred.
+     **/
+    enum class Generator {
+        BoxBlur, ///< three box blurs of the rasterized box
+        Analytic, ///< a gaussian blur of the box, in closed form
+    };
+
     // Compiler generated constructors & destructor are fine.
 
     /**
@@ -46,6 +54,17 @@ public:
      **/
     void setBorderRadius(qreal radius);
 
+    /**
+     * Set how shadows are blurred.
+     * @param generator The generator. Defaults to Generator::BoxBlur.
+     **/
+    void setGenerator(Generator generator);
+
+    /**
+     * How shadows are blurred.
+     **/
+    Generator generator() const;
+
     /**
      * Add a shadow.
      * @param offset The offset of the shadow.
@@ -56,9 +75,18 @@ public:
 
     /**
      * Render the shadow.
+     *
+     * Blurred masks are cached by box size, border radius, blur radius and scale,
+     * so rendering a shadow again in another color or opacity skips the blur.
+     * The cache is shared, render() must be called from the GUI thread.
      **/
     QImage render() const;
 
+    /**
+     * Drop all cached blurred masks.
+     **/
+    static void clearCache();
+
     /**
      * Calculate the minimum size of the box.
      *
@@ -84,6 +112,7 @@ public:
 private:
     QSizeF m_boxSize;
     qreal m_borderRadius = 0.0;
+    Generator m_generator = Generator::BoxBlur;
 
     struct Shadow {
         QPointF offset;